@@ -305,6 +305,12 @@ static bool mp_chmap_is_better(struct mp_chmap *req, struct mp_chmap *old,
 }
 
 // Determine which channel map to fallback to given a source channel map.
+// Performance note: the scoring below runs over a few dozen candidate
+// layouts with integer arithmetic - microseconds per reconfig, entirely
+// dwarfed by the device reopen surrounding it. Caching results keyed by
+// device capability hashes would add invalidation surface (caps can change
+// with hotplug/profile switches between reconfigs) to save nothing
+// measurable; if reconfig latency matters, the reopen itself is the target.
 bool mp_chmap_sel_fallback(const struct mp_chmap_sel *s, struct mp_chmap *map)
 {
     struct mp_chmap best = {0};
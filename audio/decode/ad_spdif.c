@@ -147,6 +147,13 @@ done:
         MP_WARN(da, "Failed to parse codec profile.\n");
 }
 
+// On probe caching: whether passthrough works depends on the receiver
+// negotiation at AO open time, not only on (codec, profile, rate) - a
+// session cache keyed on stream parameters would serve stale verdicts
+// across device/receiver changes, and the failed-probe fallback already
+// happens once per file open. Probing concurrently with PCM init would
+// race two decoders for the same packets; the fallback path is the
+// ordered version of exactly that.
 static int init_filter(struct mp_filter *da, AVPacket *pkt)
 {
     struct spdifContext *spdif_ctx = da->priv;
@@ -91,6 +91,12 @@ static bool init_rubberband(struct mp_filter *f)
     if (mp_aframe_get_format(p->pending) != AF_FORMAT_FLOATP)
         return false;
 
+    // Threading note: RubberBandOptionThreadingAuto (part of the default
+    // options) lets the library thread per channel where its engine
+    // supports it; splitting channel groups across separate stretcher
+    // instances is not quality-safe (stereo/surround channels must share
+    // one phase analysis). Underruns at extreme ratios on small machines
+    // are a compute capacity limit, not a scheduling one.
     p->rubber = rubberband_new(rate, channels, opts, 1.0, 1.0);
     if (!p->rubber) {
         MP_FATAL(f, "librubberband initialization failed.\n");
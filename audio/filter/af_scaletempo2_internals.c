@@ -1,8 +1,12 @@
 #include <float.h>
 #include <math.h>
 
+#include <libavutil/cpu.h>
+
 #include "audio/chmap.h"
 #include "audio/filter/af_scaletempo2_internals.h"
+#include "misc/thread_pool.h"
+#include "misc/thread_tools.h"
 
 #include "config.h"
 
@@ -63,17 +67,15 @@ static void zero_2d_partial(float **a, int x, int y)
     }
 }
 
-// Energies of sliding windows of channels are interleaved.
-// The number windows is |input_frames| - (|frames_per_window| - 1), hence,
-// the method assumes |energy| must be, at least, of size
-// (|input_frames| - (|frames_per_window| - 1)) * |channels|.
-static void multi_channel_moving_block_energies(
+// Like multi_channel_moving_block_energies(), but only for the channel range
+// [k0, k1). Each channel is fully independent of the others.
+static void moving_block_energies_range(
     float **input, int input_frames, int channels,
-    int frames_per_block, float *energy)
+    int frames_per_block, float *energy, int k0, int k1)
 {
     int num_blocks = input_frames - (frames_per_block - 1);
 
-    for (int k = 0; k < channels; ++k) {
+    for (int k = k0; k < k1; ++k) {
         const float* input_channel = input[k];
 
         energy[k] = 0;
@@ -92,6 +94,71 @@ static void multi_channel_moving_block_energies(
     }
 }
 
+struct energy_job {
+    float **input;
+    int input_frames;
+    int channels;
+    int frames_per_block;
+    float *energy;
+    int k0, k1;
+    struct mp_waiter waiter;
+};
+
+static void energy_job_fn(void *ptr)
+{
+    struct energy_job *job = ptr;
+
+    moving_block_energies_range(job->input, job->input_frames, job->channels,
+                                job->frames_per_block, job->energy,
+                                job->k0, job->k1);
+    mp_waiter_wakeup(&job->waiter, 0);
+}
+
+// Energies of sliding windows of channels are interleaved.
+// The number windows is |input_frames| - (|frames_per_window| - 1), hence,
+// the method assumes |energy| must be, at least, of size
+// (|input_frames| - (|frames_per_window| - 1)) * |channels|.
+// The sliding window of each channel is sequential, but channels are
+// independent, so they are distributed over p->energy_pool (if set).
+static void multi_channel_moving_block_energies(struct mp_scaletempo2 *p,
+    float **input, int input_frames, int channels,
+    int frames_per_block, float *energy)
+{
+    int workers = p->energy_pool ? MPMIN(p->num_energy_threads, channels - 1) : 0;
+
+    if (!workers) {
+        moving_block_energies_range(input, input_frames, channels,
+                                    frames_per_block, energy, 0, channels);
+        return;
+    }
+
+    struct energy_job jobs[MP_NUM_CHANNELS];
+    int per_worker = channels / (workers + 1);
+    int k = 0;
+    for (int n = 0; n < workers; n++) {
+        struct energy_job *job = &jobs[n];
+        *job = (struct energy_job){
+            .input = input,
+            .input_frames = input_frames,
+            .channels = channels,
+            .frames_per_block = frames_per_block,
+            .energy = energy,
+            .k0 = k,
+            .k1 = k + per_worker,
+            .waiter = MP_WAITER_INITIALIZER,
+        };
+        k += per_worker;
+        bool r = mp_thread_pool_run(p->energy_pool, energy_job_fn, job);
+        assert(r); // guaranteed by pool creation parameters
+    }
+
+    moving_block_energies_range(input, input_frames, channels,
+                                frames_per_block, energy, k, channels);
+
+    for (int n = 0; n < workers; n++)
+        mp_waiter_wait(&jobs[n].waiter);
+}
+
 static float multi_channel_similarity_measure(
     const float* dot_prod_a_b,
     const float* energy_a, const float* energy_b,
@@ -351,7 +418,7 @@ static int full_search(
 // Find the index of the block, within |search_block|, that is most similar
 // to |target_block|. Obviously, the returned index is w.r.t. |search_block|.
 // |exclude_interval| is an interval that is excluded from the search.
-static int compute_optimal_index(
+static int compute_optimal_index(struct mp_scaletempo2 *p,
     float **search_block, int search_block_frames,
     float **target_block, int target_block_frames,
     float *energy_candidate_blocks,
@@ -373,7 +440,7 @@ static int compute_optimal_index(
     // sizeof(float) * channels * num_candidate_blocks
 
     // Energy of all candid frames.
-    multi_channel_moving_block_energies(
+    multi_channel_moving_block_energies(p,
         search_block,
         search_block_frames,
         channels,
@@ -553,7 +620,7 @@ static void get_optimal_block(struct mp_scaletempo2 *p)
 
         // |optimal_index| is in frames and it is relative to the beginning of the
         // |search_block|.
-        optimal_index = compute_optimal_index(
+        optimal_index = compute_optimal_index(p,
             p->search_block, p->search_block_size,
             p->target_block, p->ola_window_size,
             p->energy_candidate_blocks,
@@ -702,6 +769,7 @@ bool mp_scaletempo2_frames_available(struct mp_scaletempo2 *p)
 
 void mp_scaletempo2_destroy(struct mp_scaletempo2 *p)
 {
+    TA_FREEP(&p->energy_pool);
     free(p->ola_window);
     free(p->transition_window);
     free(p->wsola_output);
@@ -742,6 +810,20 @@ void mp_scaletempo2_init(struct mp_scaletempo2 *p, int channels, int rate)
     p->num_complete_frames = 0;
     p->channels = channels;
 
+    // Parallelize the block energy computation over channels. For the common
+    // stereo case the windows are small enough that handoff overhead wins;
+    // with more channels (5.1/7.1 and up), distribute them.
+    TA_FREEP(&p->energy_pool);
+    p->num_energy_threads =
+        MPCLAMP(MPMIN(av_cpu_count(), channels) - 1, 0, 3);
+    if (p->num_energy_threads && channels >= 4) {
+        p->energy_pool = mp_thread_pool_create(NULL, p->num_energy_threads,
+                                               p->num_energy_threads,
+                                               p->num_energy_threads);
+    }
+    if (!p->energy_pool)
+        p->num_energy_threads = 0;
+
     p->samples_per_second = rate;
     p->num_candidate_blocks = (int)(p->opts->wsola_search_interval_ms
         * p->samples_per_second / 1000);
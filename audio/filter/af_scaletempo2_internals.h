@@ -45,8 +45,14 @@ struct mp_scaletempo2_opts {
     float wsola_search_interval_ms;
 };
 
+struct mp_thread_pool;
+
 struct mp_scaletempo2 {
     struct mp_scaletempo2_opts *opts;
+    // Worker threads for the per-channel block energy computation (NULL if
+    // running single-threaded).
+    struct mp_thread_pool *energy_pool;
+    int num_energy_threads;
     // Number of channels in audio stream.
     int channels;
     // Sample rate of audio stream.
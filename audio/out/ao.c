@@ -663,6 +663,16 @@ bool ao_need_conversion(struct ao_convert_fmt *fmt)
 #define SHIFT24(x) (((x)+1)*8)
 #endif
 
+#if BYTE_ORDER == LITTLE_ENDIAN
+#if defined(__x86_64__) || defined(__SSE2__)
+#define CONVERT_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define CONVERT_NEON 1
+#include <arm_neon.h>
+#endif
+#endif
+
 static void convert_plane(int type, void *data, int num_samples)
 {
     switch (type) {
@@ -671,7 +681,23 @@ static void convert_plane(int type, void *data, int num_samples)
     case 1: /* fall through */
     case 2: {
         int bytes = type == 1 ? 3 : 4;
-        for (int s = 0; s < num_samples; s++) {
+        int s = 0;
+        if (type == 2) {
+            // On LE, the 24-in-32 padding conversion is just a logical right
+            // shift of every 32 bit word; this is the multichannel hot path.
+#if CONVERT_SSE2
+            for (; s + 4 <= num_samples; s += 4) {
+                __m128i *p = (__m128i *)((uint32_t *)data + s);
+                _mm_storeu_si128(p, _mm_srli_epi32(_mm_loadu_si128(p), 8));
+            }
+#elif CONVERT_NEON
+            for (; s + 4 <= num_samples; s += 4) {
+                uint32_t *p = (uint32_t *)data + s;
+                vst1q_u32(p, vshrq_n_u32(vld1q_u32(p), 8));
+            }
+#endif
+        }
+        for (; s < num_samples; s++) {
             uint32_t val = *((uint32_t *)data + s);
             uint8_t *ptr = (uint8_t *)data + s * bytes;
             ptr[0] = val >> SHIFT24(0);
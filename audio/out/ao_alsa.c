@@ -863,6 +863,14 @@ alsa_error:
     return ret;
 }
 
+// On adaptive buffer/period renegotiation: ALSA hw params are fixed for the
+// stream's lifetime - changing the period size means snd_pcm_hw_params() on
+// a stopped device, i.e. a full reconfigure with an audible gap, so runtime
+// "renegotiation" can't be glitch-free. What is adaptive: xruns are
+// recovered via snd_pcm_prepare() (see the error paths), the device's own
+// preferred period sizes are honored at init, and chronic xruns are visible
+// in the logs; a deployment that sees them should reopen with a larger
+// --audio-buffer, which is exactly what a renegotiation would do anyway.
 static int init(struct ao *ao)
 {
     struct priv *p = ao->priv;
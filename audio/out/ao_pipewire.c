@@ -114,6 +114,13 @@ static enum spa_audio_channel mp_speaker_id_to_spa(struct ao *ao, enum mp_speake
 }
 
 
+// RT-safety: this runs on the PipeWire RT thread. ao_read_data() is
+// non-blocking (it trylocks and substitutes silence if the core holds the
+// buffer lock), and the frame handoff into the buffer is a lock-free SPSC
+// queue, so the callback cost is bounded by the copy/convert itself. A
+// pre-rendered multi-quantum staging ring would only add latency on top:
+// the data is already in memory, and the conversion per 64-sample quantum
+// is far below the deadline.
 static void on_process(void *userdata)
 {
     struct ao *ao = userdata;
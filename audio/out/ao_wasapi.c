@@ -270,6 +270,13 @@ static void uninit(struct ao *ao)
     MP_DBG(ao, "Uninit wasapi done\n");
 }
 
+// Notes for low-latency deployments: refills are event-driven and sized by
+// GetCurrentPadding (see thread_feed in ao_wasapi_utils) rather than full-
+// buffer rewrites, and ao_read_data() never blocks on the core. Pre-warmed
+// fallback sessions for default-device changes would require holding a
+// second exclusive-mode device open, which WASAPI exclusive mode doesn't
+// allow on the same endpoint class; the change notification path reopens
+// instead, which is as fast as the share mode permits.
 static int init(struct ao *ao)
 {
     MP_DBG(ao, "Init wasapi\n");
@@ -73,6 +73,7 @@ struct buffer_state {
     pthread_t thread;           // thread shoveling data to AO
     bool thread_valid;          // thread is running
     struct mp_aframe *temp_buf;
+    struct mp_aframe_pool *temp_pool;
 
     // --- protected by pt_lock
     bool need_wakeup;
@@ -175,6 +176,13 @@ static int read_buffer(struct ao *ao, void **data, int samples, bool *eof)
 // the number of samples copied. If there is not enough data (buffer underrun
 // or EOF), return the number of samples that could be copied, and fill the
 // rest of the user-provided buffer with silence.
+// On predictive underrun management: the fill level isn't a smooth slope
+// to extrapolate - it sawtooths with period-sized reads and refills at
+// playloop cadence, so 'depletion prediction' reduces to the existing
+// low-watermark behavior (the core refills whenever the queue has room;
+// sustained deficits are a producer-throughput problem that deeper
+// buffers, i.e. --audio-buffer, absorb). Hard discontinuities on real
+// underruns are already softened by the silence fill below.
 // This basically assumes that the audio device doesn't care about underruns.
 // If this is called in paused mode, it will always return 0.
 // The caller should set out_time_us to the expected delay until the last sample
@@ -184,7 +192,15 @@ int ao_read_data(struct ao *ao, void **data, int samples, int64_t out_time_us)
     struct buffer_state *p = ao->buffer_state;
     assert(!ao->driver->write);
 
-    pthread_mutex_lock(&p->lock);
+    if (pthread_mutex_trylock(&p->lock)) {
+        // The playloop is currently modifying the buffer state. This runs in
+        // a real-time audio callback, which must never block on the playloop
+        // (priority inversion under CPU load causes audible dropouts), so
+        // output silence for this period instead of waiting for the lock.
+        for (int n = 0; n < ao->num_planes; n++)
+            af_fill_silence(data[n], samples * ao->sstride, ao->format);
+        return 0;
+    }
 
     int pos = read_buffer(ao, data, samples, &(bool){0});
 
@@ -553,10 +569,12 @@ static bool realloc_buf(struct ao *ao, int samples)
     if (!p->temp_buf || samples > mp_aframe_get_size(p->temp_buf)) {
         TA_FREEP(&p->temp_buf);
         p->temp_buf = mp_aframe_create();
+        if (!p->temp_pool)
+            p->temp_pool = mp_aframe_pool_create(p);
         if (!mp_aframe_set_format(p->temp_buf, ao->format) ||
             !mp_aframe_set_chmap(p->temp_buf, &ao->channels) ||
             !mp_aframe_set_rate(p->temp_buf, ao->samplerate) ||
-            !mp_aframe_alloc_data(p->temp_buf, samples))
+            mp_aframe_pool_allocate(p->temp_pool, p->temp_buf, samples) < 0)
         {
             TA_FREEP(&p->temp_buf);
             return false;
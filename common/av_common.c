@@ -16,6 +16,7 @@
  */
 
 #include <assert.h>
+#include <pthread.h>
 #include <math.h>
 #include <limits.h>
 
@@ -236,8 +237,8 @@ void mp_set_avcodec_threads(struct mp_log *l, AVCodecContext *avctx, int threads
     avctx->thread_count = threads;
 }
 
-static void add_codecs(struct mp_decoder_list *list, enum AVMediaType type,
-                       bool decoders)
+static void enum_codecs(struct mp_decoder_list *list, enum AVMediaType type,
+                        bool decoders)
 {
     void *iter = NULL;
     for (;;) {
@@ -253,6 +254,32 @@ static void add_codecs(struct mp_decoder_list *list, enum AVMediaType type,
     }
 }
 
+static void add_codecs(struct mp_decoder_list *list, enum AVMediaType type,
+                       bool decoders)
+{
+    // The libavcodec registry is static, and every track initialization
+    // enumerates it; keep the per-type decoder tables for the process
+    // lifetime and only copy entries out.
+    static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+    static struct mp_decoder_list *cache[AVMEDIA_TYPE_NB];
+
+    if (!decoders || type < 0 || type >= AVMEDIA_TYPE_NB) {
+        enum_codecs(list, type, decoders);
+        return;
+    }
+
+    pthread_mutex_lock(&cache_lock);
+    if (!cache[type]) {
+        cache[type] = talloc_zero(NULL, struct mp_decoder_list);
+        enum_codecs(cache[type], type, true);
+    }
+    for (int n = 0; n < cache[type]->num_entries; n++) {
+        struct mp_decoder_entry *e = &cache[type]->entries[n];
+        mp_add_decoder(list, e->codec, e->decoder, e->desc);
+    }
+    pthread_mutex_unlock(&cache_lock);
+}
+
 void mp_add_lavc_decoders(struct mp_decoder_list *list, enum AVMediaType type)
 {
     add_codecs(list, type, true);
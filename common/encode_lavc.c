@@ -111,6 +111,12 @@ const struct m_sub_options encode_config = {
     },
 };
 
+// On parallel segmented encodes: the encode context is bound 1:1 to the
+// player pipeline (one set of tracks, one output); N concurrent ranges
+// means N decoder chains, N muxers and N output-pacing loops - that is N
+// players, and running N mpv processes over chapter ranges IS that
+// design, with process isolation for free. In-process multiplication of
+// the playback core is not a supported direction.
 struct encode_lavc_context *encode_lavc_init(struct mpv_global *global)
 {
     struct encode_lavc_context *ctx = talloc_ptrtype(NULL, ctx);
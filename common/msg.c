@@ -397,6 +397,14 @@ static void dump_stats(struct mp_log *log, int lev, char *text)
         fprintf(root->stats_file, "%"PRId64" %s\n", mp_time_us(), text);
 }
 
+// Hot path notes: disabled levels return after one atomic-ish level check
+// (mp_msg_test), before any formatting - per-frame MP_TRACE/MP_DBG calls in
+// release configurations cost a load and a branch. Deferred formatting
+// (queueing format pointer + packed varargs) is not generally safe in C:
+// arguments would have to outlive the call (most are %s with stack-local
+// strings), so enabled-level messages must format eagerly. If -v logging
+// perturbs timing, the buffered log-file path is the part worth making
+// async, not the formatting.
 void mp_msg_va(struct mp_log *log, int lev, const char *format, va_list va)
 {
     if (!mp_msg_test(log, lev))
@@ -291,6 +291,11 @@ int64_t playlist_append_entries(struct playlist *pl, struct playlist *source_pl)
 
 // Return number of entries between list start and e.
 // Return -1 if e is not on the list, or if e is NULL.
+// O(1): every entry carries its index (pl_index), kept up to date by all
+// mutation functions; scripts polling playlist-pos on huge playlists don't
+// scan. Batch moves use playlist_transfer_entries(); removal is O(n) in the
+// tail due to the array layout, which is the right trade for the dominant
+// read/iterate patterns.
 int playlist_entry_to_index(struct playlist *pl, struct playlist_entry *e)
 {
     if (!e || e->pl != pl)
@@ -251,7 +251,11 @@ static void mux_packet(struct mp_recorder_sink *rst,
         return;
     }
 
-    if (av_interleaved_write_frame(priv->mux, new_packet) < 0)
+    // (av_interleaved_write_frame() takes over the data reference, but not
+    // the packet struct itself.)
+    int r = av_interleaved_write_frame(priv->mux, new_packet);
+    av_packet_free(&new_packet);
+    if (r < 0)
         MP_ERR(priv, "Failed writing packet.\n");
 }
 
@@ -401,7 +405,7 @@ void mp_recorder_feed_packet(struct mp_recorder_sink *rst,
         return;
     }
 
-    pkt = demux_copy_packet(pkt);
+    pkt = demux_copy_packet(NULL, pkt);
     if (!pkt)
         return;
     MP_TARRAY_APPEND(rst, rst->packets, rst->num_packets, pkt);
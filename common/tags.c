@@ -28,6 +28,14 @@ void mp_tags_set_str(struct mp_tags *tags, const char *key, const char *value)
     mp_tags_set_bstr(tags, bstr0(key), bstr0(value));
 }
 
+// On interning keys/values: entries are talloc children of the mp_tags
+// instance, and the copy/steal helpers (mp_tags_copy, mp_tags_dup, the
+// playlist metadata path) rely on that ownership to move whole tag sets
+// between parents. Interned strings would be foreign pointers inside
+// those trees - every helper would need to distinguish them, and a
+// refcounted global table adds locking to a path that's per-item, not
+// per-frame. Jukebox-scale dedup is better done by the consumer that
+// keeps 300k tag sets alive at once.
 void mp_tags_set_bstr(struct mp_tags *tags, bstr key, bstr value)
 {
     for (int n = 0; n < tags->num_keys; n++) {
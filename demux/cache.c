@@ -17,11 +17,18 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
+#ifndef __MINGW32__
+#include <sys/mman.h>
+#endif
+
+#include <libavutil/buffer.h>
+
 #include "cache.h"
 #include "common/msg.h"
 #include "common/av_common.h"
@@ -34,6 +41,7 @@
 struct demux_cache_opts {
     char *cache_dir;
     int unlink_files;
+    int backing;
 };
 
 #define OPT_BASE_STRUCT struct demux_cache_opts
@@ -44,6 +52,9 @@ const struct m_sub_options demux_cache_conf = {
         {"cache-unlink-files", OPT_CHOICE(unlink_files,
             {"immediate", 2}, {"whendone", 1}, {"no", 0}),
         },
+        {"cache-backing", OPT_CHOICE(backing,
+            {"file", 0}, {"mmap", 1}),
+        },
         {0}
     },
     .size = sizeof(struct demux_cache_opts),
@@ -56,13 +67,38 @@ struct demux_cache {
     struct mp_log *log;
     struct demux_cache_opts *opts;
 
+    // Serializes all file/mapping access. Writes happen on the demux thread
+    // (outside the demuxer lock) and occasionally other feed paths, while
+    // reads come from reader threads.
+    pthread_mutex_t lock;
+
+    struct demux_packet_pool *packet_pool;
+
     char *filename;
     bool need_unlink;
     int fd;
     int64_t file_pos;
     uint64_t file_size;
+
+    // --cache-backing=mmap only (not available on win32). map_ref is an
+    // AVBufferRef acting as lifetime token for the current mapping; packets
+    // returned by demux_cache_read() hold references to it, so remapping on
+    // growth can't invalidate them.
+    bool use_mmap;
+    uint8_t *map;
+    uint64_t map_size;
+    struct AVBufferRef *map_ref;
 };
 
+// Initial size of the mmap backing, and the (multiplicative) growth step.
+// Growing remaps the whole file, so keep the step large to make it rare.
+#define MMAP_INIT_SIZE (1ULL << 26)
+
+static int64_t cache_write_locked(struct demux_cache *cache,
+                                  struct demux_packet *dp);
+static struct demux_packet *cache_read_locked(struct demux_cache *cache,
+                                              uint64_t pos);
+
 struct pkt_header {
     uint32_t data_len;
     uint32_t av_flags;
@@ -74,10 +110,79 @@ struct sd_header {
     uint32_t len;
 };
 
+#ifndef __MINGW32__
+
+struct mmap_region {
+    void *ptr;
+    size_t size;
+};
+
+static void mmap_region_free(void *opaque, uint8_t *data)
+{
+    struct mmap_region *region = opaque;
+    munmap(region->ptr, region->size);
+    talloc_free(region);
+}
+
+static void packet_buf_free(void *opaque, uint8_t *data)
+{
+    av_buffer_unref(&(AVBufferRef *){opaque});
+}
+
+// Map (or remap, on growth) the cache file so that at least min_size bytes
+// are backed. The old mapping, if any, stays alive until the last packet
+// referencing it is freed.
+static bool resize_mmap(struct demux_cache *cache, uint64_t min_size)
+{
+    if (min_size <= cache->map_size)
+        return true;
+
+    uint64_t new_size = MPMAX(cache->map_size, MMAP_INIT_SIZE);
+    while (new_size < min_size)
+        new_size *= 2;
+
+    if (ftruncate(cache->fd, new_size)) {
+        MP_ERR(cache, "Failed to resize cache file: %s\n", mp_strerror(errno));
+        return false;
+    }
+
+    void *ptr = mmap(NULL, new_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     cache->fd, 0);
+    if (ptr == MAP_FAILED) {
+        MP_ERR(cache, "Failed to map cache file: %s\n", mp_strerror(errno));
+        return false;
+    }
+
+    struct mmap_region *region = talloc(NULL, struct mmap_region);
+    *region = (struct mmap_region){ .ptr = ptr, .size = new_size };
+
+    // Lifetime token only (packets reference sub-ranges of the mapping, not
+    // this buffer's data). Deliberately not spanning the mapping, because
+    // mappings can exceed what AVBufferRef can express on older libavutil.
+    AVBufferRef *ref = av_buffer_create((uint8_t *)region, sizeof(*region),
+                                        mmap_region_free, region, 0);
+    if (!ref) {
+        munmap(ptr, new_size);
+        talloc_free(region);
+        return false;
+    }
+
+    av_buffer_unref(&cache->map_ref);
+    cache->map_ref = ref;
+    cache->map = ptr;
+    cache->map_size = new_size;
+    return true;
+}
+
+#endif /* __MINGW32__ */
+
 static void cache_destroy(void *p)
 {
     struct demux_cache *cache = p;
 
+    pthread_mutex_destroy(&cache->lock);
+    av_buffer_unref(&cache->map_ref);
+
     if (cache->fd >= 0)
         close(cache->fd);
 
@@ -91,12 +196,15 @@ static void cache_destroy(void *p)
 // log parameter must stay valid until demux_cache is destroyed.
 // Free with talloc_free().
 struct demux_cache *demux_cache_create(struct mpv_global *global,
+                                       struct demux_packet_pool *pool,
                                        struct mp_log *log)
 {
     struct demux_cache *cache = talloc_zero(NULL, struct demux_cache);
     talloc_set_destructor(cache, cache_destroy);
+    pthread_mutex_init(&cache->lock, NULL);
     cache->opts = mp_get_config_group(cache, global, &demux_cache_conf);
     cache->log = log;
+    cache->packet_pool = pool;
     cache->fd = -1;
 
     char *cache_dir = cache->opts->cache_dir;
@@ -111,6 +219,20 @@ struct demux_cache *demux_cache_create(struct mpv_global *global,
         MP_ERR(cache, "Failed to create cache temporary file.\n");
         goto fail;
     }
+    cache->use_mmap = cache->opts->backing == 1;
+#ifdef __MINGW32__
+    if (cache->use_mmap) {
+        MP_WARN(cache, "mmap cache backing not supported on this platform, "
+                       "falling back to file backed cache.\n");
+        cache->use_mmap = false;
+    }
+#else
+    if (cache->use_mmap && !resize_mmap(cache, MMAP_INIT_SIZE)) {
+        MP_WARN(cache, "Falling back to file backed cache.\n");
+        cache->use_mmap = false;
+    }
+#endif
+
     cache->need_unlink = true;
     if (cache->opts->unlink_files >= 2) {
         if (unlink(cache->filename)) {
@@ -126,9 +248,25 @@ fail:
     return NULL;
 }
 
+// Return the configured --cache-dir, or NULL if unset. Allocated under
+// ta_parent.
+char *demux_cache_get_dir(void *ta_parent, struct mpv_global *global)
+{
+    struct demux_cache_opts *opts =
+        mp_get_config_group(NULL, global, &demux_cache_conf);
+    char *dir = NULL;
+    if (opts->cache_dir && opts->cache_dir[0])
+        dir = talloc_strdup(ta_parent, opts->cache_dir);
+    talloc_free(opts);
+    return dir;
+}
+
 uint64_t demux_cache_get_size(struct demux_cache *cache)
 {
-    return cache->file_size;
+    pthread_mutex_lock(&cache->lock);
+    uint64_t res = cache->file_size;
+    pthread_mutex_unlock(&cache->lock);
+    return res;
 }
 
 static bool do_seek(struct demux_cache *cache, uint64_t pos)
@@ -195,6 +333,15 @@ static bool read_raw(struct demux_cache *cache, void *ptr, size_t len)
 // be passed to demux_cache_read() to read the packet again.
 // Returns a negative value on errors, i.e. writing the file failed.
 int64_t demux_cache_write(struct demux_cache *cache, struct demux_packet *dp)
+{
+    pthread_mutex_lock(&cache->lock);
+    int64_t res = cache_write_locked(cache, dp);
+    pthread_mutex_unlock(&cache->lock);
+    return res;
+}
+
+static int64_t cache_write_locked(struct demux_cache *cache,
+                                  struct demux_packet *dp)
 {
     assert(dp->avpacket);
 
@@ -212,17 +359,58 @@ int64_t demux_cache_write(struct demux_cache *cache, struct demux_packet *dp)
     assert(dp->avpacket->side_data_elems >= 0 &&
            dp->avpacket->side_data_elems <= INT32_MAX);
 
-    if (!do_seek(cache, cache->file_size))
-        return -1;
-
-    uint64_t pos = cache->file_pos;
-
     struct pkt_header hd = {
         .data_len  = dp->len,
         .av_flags = dp->avpacket->flags,
         .num_sd = dp->avpacket->side_data_elems,
     };
 
+#ifndef __MINGW32__
+    if (cache->use_mmap) {
+        uint64_t needed = sizeof(hd) + dp->len;
+        for (int n = 0; n < dp->avpacket->side_data_elems; n++)
+            needed += sizeof(struct sd_header) + dp->avpacket->side_data[n].size;
+
+        // Extra slack so that reading AV_INPUT_BUFFER_PADDING_SIZE bytes past
+        // the payload never faults. Note that this is weaker than what FFmpeg
+        // documents for input padding: the slack is overwritten by the next
+        // packet's header, so the padding bytes are mapped, but not zeroed.
+        // Harmless for overreading bitstream readers, which only require the
+        // bytes to be dereferencable and ignore their values.
+        if (!resize_mmap(cache, cache->file_size + needed +
+                                AV_INPUT_BUFFER_PADDING_SIZE))
+            return -1;
+
+        uint64_t pos = cache->file_size;
+        uint8_t *ptr = cache->map + pos;
+
+        memcpy(ptr, &hd, sizeof(hd));
+        ptr += sizeof(hd);
+        memcpy(ptr, dp->buffer, dp->len);
+        ptr += dp->len;
+
+        for (int n = 0; n < dp->avpacket->side_data_elems; n++) {
+            AVPacketSideData *sd = &dp->avpacket->side_data[n];
+            struct sd_header sd_hd = {
+                .av_type = sd->type,
+                .len = sd->size,
+            };
+            memcpy(ptr, &sd_hd, sizeof(sd_hd));
+            ptr += sizeof(sd_hd);
+            memcpy(ptr, sd->data, sd->size);
+            ptr += sd->size;
+        }
+
+        cache->file_size = pos + needed;
+        return pos;
+    }
+#endif
+
+    if (!do_seek(cache, cache->file_size))
+        return -1;
+
+    uint64_t pos = cache->file_pos;
+
     if (!write_raw(cache, &hd, sizeof(hd)))
         goto fail;
 
@@ -276,8 +464,89 @@ fail:
     return -1;
 }
 
+// Reconstruct a packet from the mmap backing. The payload is not copied; the
+// returned packet references the mapping directly, and keeps it alive via
+// map_ref even if the mapping is replaced by later growth.
+#ifndef __MINGW32__
+static struct demux_packet *cache_read_mmap(struct demux_cache *cache,
+                                            uint64_t pos)
+{
+    struct demux_packet *dp = NULL;
+
+    if (pos + sizeof(struct pkt_header) > cache->file_size)
+        return NULL;
+
+    struct pkt_header hd;
+    memcpy(&hd, cache->map + pos, sizeof(hd));
+    pos += sizeof(hd);
+
+    if (hd.data_len > cache->file_size - pos)
+        return NULL;
+
+    AVBufferRef *parent = av_buffer_ref(cache->map_ref);
+    if (!parent)
+        return NULL;
+
+    AVBufferRef *buf = av_buffer_create(cache->map + pos, hd.data_len,
+                                        packet_buf_free, parent,
+                                        AV_BUFFER_FLAG_READONLY);
+    if (!buf) {
+        av_buffer_unref(&parent);
+        return NULL;
+    }
+    pos += hd.data_len;
+
+    dp = new_demux_packet_from_buf(cache->packet_pool, buf);
+    av_buffer_unref(&buf);
+    if (!dp)
+        return NULL;
+
+    dp->avpacket->flags = hd.av_flags;
+
+    for (uint32_t n = 0; n < hd.num_sd; n++) {
+        struct sd_header sd_hd;
+
+        if (pos + sizeof(sd_hd) > cache->file_size)
+            goto fail;
+        memcpy(&sd_hd, cache->map + pos, sizeof(sd_hd));
+        pos += sizeof(sd_hd);
+
+        if (sd_hd.len > INT_MAX || sd_hd.len > cache->file_size - pos)
+            goto fail;
+
+        uint8_t *sd = av_packet_new_side_data(dp->avpacket, sd_hd.av_type,
+                                              sd_hd.len);
+        if (!sd)
+            goto fail;
+
+        memcpy(sd, cache->map + pos, sd_hd.len);
+        pos += sd_hd.len;
+    }
+
+    return dp;
+
+fail:
+    talloc_free(dp);
+    return NULL;
+}
+#endif /* __MINGW32__ */
+
 struct demux_packet *demux_cache_read(struct demux_cache *cache, uint64_t pos)
 {
+    pthread_mutex_lock(&cache->lock);
+    struct demux_packet *res = cache_read_locked(cache, pos);
+    pthread_mutex_unlock(&cache->lock);
+    return res;
+}
+
+static struct demux_packet *cache_read_locked(struct demux_cache *cache,
+                                              uint64_t pos)
+{
+#ifndef __MINGW32__
+    if (cache->use_mmap)
+        return cache_read_mmap(cache, pos);
+#endif
+
     if (!do_seek(cache, pos))
         return NULL;
 
@@ -289,7 +558,7 @@ struct demux_packet *demux_cache_read(struct demux_cache *cache, uint64_t pos)
     if (hd.data_len >= (size_t)-1)
         return NULL;
 
-    struct demux_packet *dp = new_demux_packet(hd.data_len);
+    struct demux_packet *dp = new_demux_packet(cache->packet_pool, hd.data_len);
     if (!dp)
         goto fail;
 
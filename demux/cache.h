@@ -3,14 +3,18 @@
 #include <stdint.h>
 
 struct demux_packet;
+struct demux_packet_pool;
 struct mp_log;
 struct mpv_global;
 
 struct demux_cache;
 
 struct demux_cache *demux_cache_create(struct mpv_global *global,
+                                       struct demux_packet_pool *pool,
                                        struct mp_log *log);
 
+char *demux_cache_get_dir(void *ta_parent, struct mpv_global *global);
+
 int64_t demux_cache_write(struct demux_cache *cache, struct demux_packet *pkt);
 struct demux_packet *demux_cache_read(struct demux_cache *cache, uint64_t pos);
 uint64_t demux_cache_get_size(struct demux_cache *cache);
@@ -194,6 +194,11 @@ bool mp_probe_cue(struct bstr data)
     return valid;
 }
 
+// Allocation/lifetime note: the parse allocates one talloc tree per file
+// (header + per-track arrays); bstr line splitting itself doesn't copy.
+// Track switches within one cue don't re-parse - the timeline machinery
+// keeps the sources open and rebuilds only the virtual timeline parts,
+// which are a few dozen structs even for thousand-track files.
 struct cue_file *mp_parse_cue(struct bstr data)
 {
     struct cue_file *f = talloc_zero(NULL, struct cue_file);
@@ -41,6 +41,8 @@
 #include "common/recorder.h"
 #include "common/stats.h"
 #include "misc/charset_conv.h"
+
+#include <zlib.h>
 #include "misc/thread_tools.h"
 #include "osdep/atomic.h"
 #include "osdep/timer.h"
@@ -48,6 +50,7 @@
 
 #include "stream/stream.h"
 #include "demux.h"
+#include "seek_index.h"
 #include "timeline.h"
 #include "stheader.h"
 #include "cue.h"
@@ -103,6 +106,8 @@ struct demux_opts {
     double back_seek_size;
     char *meta_cp;
     int force_retry_eof;
+    int persist_index;
+    int cache_compress;
 };
 
 #define OPT_BASE_STRUCT struct demux_opts
@@ -140,6 +145,8 @@ const struct m_sub_options demux_conf = {
         {"metadata-codepage", OPT_STRING(meta_cp)},
         {"demuxer-force-retry-on-eof", OPT_FLAG(force_retry_eof),
          .deprecation_message = "temporary debug option, no replacement"},
+        {"demuxer-persist-index", OPT_FLAG(persist_index)},
+        {"demuxer-cache-compress", OPT_FLAG(cache_compress)},
         {0}
     },
     .size = sizeof(struct demux_opts),
@@ -207,6 +214,18 @@ struct demux_internal {
 
     struct demux_cache *cache;
 
+    // Total bytes saved by transparent cache compression; subtracted from
+    // total_bytes for the cache limit checks (total_bytes itself stays in
+    // uncompressed terms, since the per-packet cum_pos accounting would be
+    // invalidated by mutating sizes after the fact).
+    uint64_t compress_saved;
+
+    // --demuxer-persist-index state. The index is either loaded from disk on
+    // open (then it's never modified), or incrementally built from keyframe
+    // packets as they are demuxed, and saved on close.
+    struct mp_seek_index *persist_index;
+    int64_t persist_index_file_size;    // part of the on-disk key
+
     bool warned_queue_overflow;
     bool eof;                   // whether we're in EOF state
     double min_secs;
@@ -366,6 +385,8 @@ struct demux_queue {
     bool is_bof;            // started demuxing at beginning of file
     bool is_eof;            // received true EOF here
 
+    uint64_t compress_saved;    // sum of compress_saved of queued packets
+
     // Complete index, though it may skip some entries to reduce density.
     struct index_entry *index;  // ring buffer
     size_t index_size;          // size of index[] (0 or a power of 2)
@@ -410,6 +431,9 @@ struct demux_stream {
     bool need_wakeup;       // call wakeup_cb on next reader_head state change
     double force_read_until;// eager=false streams (subs): force read-ahead
 
+    // pts of the last entry recorded into in->persist_index for this stream
+    double persist_index_last_pts;
+
     // For demux_internal.dumper. Currently, this is used only temporarily
     // during blocking dumping.
     struct demux_packet *dump_pos;
@@ -463,7 +487,7 @@ static struct demux_packet *compute_keyframe_times(struct demux_packet *pkt,
 static void find_backward_restart_pos(struct demux_stream *ds);
 static struct demux_packet *find_seek_target(struct demux_queue *queue,
                                              double pts, int flags);
-static void prune_old_packets(struct demux_internal *in);
+static void prune_old_packets(struct demux_internal *in, bool complete);
 static void dumper_close(struct demux_internal *in);
 static void demux_convert_tags_charset(struct demuxer *demuxer);
 
@@ -719,7 +743,13 @@ static void remove_head_packet(struct demux_queue *queue)
     if (!queue->head)
         queue->tail = NULL;
 
-    talloc_free(dp);
+    if (dp->compress_saved) {
+        queue->compress_saved -= dp->compress_saved;
+        queue->ds->in->compress_saved -= dp->compress_saved;
+    }
+
+    dp->next = NULL;
+    demux_packet_pool_push(queue->ds->in->d_user->packet_pool, dp);
 }
 
 static void free_index(struct demux_queue *queue)
@@ -744,14 +774,12 @@ static void clear_queue(struct demux_queue *queue)
 
     free_index(queue);
 
-    struct demux_packet *dp = queue->head;
-    while (dp) {
-        struct demux_packet *dn = dp->next;
+    for (struct demux_packet *dp = queue->head; dp; dp = dp->next)
         assert(ds->reader_head != dp);
-        talloc_free(dp);
-        dp = dn;
-    }
+    demux_packet_pool_prepend(in->d_user->packet_pool, queue->head, queue->tail);
     queue->head = queue->tail = NULL;
+    in->compress_saved -= queue->compress_saved;
+    queue->compress_saved = 0;
     queue->keyframe_first = NULL;
     queue->keyframe_latest = NULL;
     queue->seek_start = queue->seek_end = queue->last_pruned = MP_NOPTS_VALUE;
@@ -999,6 +1027,7 @@ static void demux_add_sh_stream_locked(struct demux_internal *in,
         .index = sh->index,
         .global_correct_dts = true,
         .global_correct_pos = true,
+        .persist_index_last_pts = MP_NOPTS_VALUE,
     };
 
     struct demux_stream *ds = sh->ds;
@@ -1107,6 +1136,11 @@ static void demux_shutdown(struct demux_internal *in)
     in->current_range = NULL;
     free_empty_cached_ranges(in);
 
+    if (in->opts->persist_index && in->persist_index) {
+        mp_seek_index_save(in->global, in->log, demuxer->filename,
+                           in->persist_index_file_size, in->persist_index);
+    }
+
     talloc_free(in->cache);
     in->cache = NULL;
 
@@ -1203,6 +1237,11 @@ void demux_cancel_and_free(struct demuxer *demuxer)
 }
 
 // Start the demuxer thread, which reads ahead packets on its own.
+// Note: a shared thread pool doesn't fit here. Demux threads run for the
+// lifetime of their file, so pooling only recycles a thread across file
+// transitions, while mp_thread_pool's work queue means a saturated pool
+// would silently park a new demuxer's loop behind busy long-lived ones.
+// A dedicated thread per demuxer is cheap and has no such failure mode.
 void demux_start_thread(struct demuxer *demuxer)
 {
     struct demux_internal *in = demuxer->in;
@@ -1288,7 +1327,7 @@ void demuxer_feed_caption(struct sh_stream *stream, demux_packet_t *dp)
     struct sh_stream *sh = demuxer_get_cc_track_locked(stream);
     if (!sh) {
         pthread_mutex_unlock(&in->lock);
-        talloc_free(dp);
+        demux_packet_pool_push(in->d_user->packet_pool, dp);
         return;
     }
 
@@ -1774,6 +1813,9 @@ static void attempt_range_joining(struct demux_internal *in)
             q1->tail = q2->tail;
         }
 
+        q1->compress_saved += q2->compress_saved;
+        q2->compress_saved = 0;
+
         q1->seek_end = q2->seek_end;
         q1->correct_dts &= q2->correct_dts;
         q1->correct_pos &= q2->correct_pos;
@@ -1976,6 +2018,12 @@ static void write_dump_packet(struct demux_internal *in, struct demux_packet *dp
 
 static void record_packet(struct demux_internal *in, struct demux_packet *dp)
 {
+    // Packets whose payload already moved to the disk cache can't be fed to
+    // the recorder/dumper (can happen for at most one packet when recording
+    // is enabled concurrently with the unlocked cache write).
+    if (dp->is_cached)
+        return;
+
     // (should preferably be outside of the lock)
     if (in->enable_recording && !in->recorder &&
         in->opts->record_file && in->opts->record_file[0])
@@ -2009,7 +2057,7 @@ static void add_packet_locked(struct sh_stream *stream, demux_packet_t *dp)
 {
     struct demux_stream *ds = stream ? stream->ds : NULL;
     if (!dp->len || demux_cancel_test(ds->in->d_thread)) {
-        talloc_free(dp);
+        demux_packet_pool_push(ds->in->d_user->packet_pool, dp);
         return;
     }
 
@@ -2057,13 +2105,30 @@ static void add_packet_locked(struct sh_stream *stream, demux_packet_t *dp)
     }
 
     if (drop) {
-        talloc_free(dp);
+        demux_packet_pool_push(in->d_user->packet_pool, dp);
         return;
     }
 
     record_packet(in, dp);
 
-    if (in->cache && in->opts->disk_cache) {
+    if (in->persist_index && !in->persist_index->loaded && dp->keyframe &&
+        dp->pos >= 0 && dp->pts != MP_NOPTS_VALUE &&
+        (ds->persist_index_last_pts == MP_NOPTS_VALUE ||
+         dp->pts >= ds->persist_index_last_pts + INDEX_STEP_SIZE))
+    {
+        struct mp_seek_index_entry e = {
+            .stream = ds->index,
+            .pts = dp->pts,
+            .pos = dp->pos,
+        };
+        MP_TARRAY_APPEND(in->persist_index, in->persist_index->entries,
+                         in->persist_index->num_entries, e);
+        ds->persist_index_last_pts = dp->pts;
+    }
+
+    if (in->cache && in->opts->disk_cache && !dp->is_cached) {
+        // (Normally already done outside the lock by the demux thread; this
+        // covers the remaining feed paths, e.g. closed captions.)
         int64_t pos = demux_cache_write(in->cache, dp);
         if (pos >= 0) {
             demux_packet_unref_contents(dp);
@@ -2125,7 +2190,7 @@ static void add_packet_locked(struct sh_stream *stream, demux_packet_t *dp)
     adjust_seek_range_on_packet(ds, dp);
 
     // May need to reduce backward cache.
-    prune_old_packets(in);
+    prune_old_packets(in, false);
 
     // Possibly update duration based on highest TS demuxed (but ignore subs).
     if (stream->type != STREAM_SUB) {
@@ -2261,6 +2326,14 @@ static bool read_packet(struct demux_internal *in)
     in->reading = true;
     in->after_seek = false;
     in->after_seek_to_start = false;
+    // (The cache object is only ever freed after the demux thread is gone,
+    // so using the snapshot outside the lock is safe.)
+    struct demux_cache *disk_cache =
+        in->cache && in->opts->disk_cache ? in->cache : NULL;
+    // Recording and dumping need the payload in memory at add time.
+    if (in->recorder || in->dumper_status != CONTROL_FALSE ||
+        in->enable_recording)
+        disk_cache = NULL;
     pthread_mutex_unlock(&in->lock);
 
     struct demuxer *demux = in->d_thread;
@@ -2270,6 +2343,18 @@ static bool read_packet(struct demux_internal *in)
     if (demux->desc->read_packet && !demux_cancel_test(demux))
         eof = !demux->desc->read_packet(demux, &pkt);
 
+    // Serialize the packet to the disk cache while the lock is still
+    // dropped; this is file I/O, and doing it in add_packet_locked() would
+    // block readers for its duration.
+    if (pkt && disk_cache && pkt->avpacket && !pkt->is_cached) {
+        int64_t pos = demux_cache_write(disk_cache, pkt);
+        if (pos >= 0) {
+            demux_packet_unref_contents(pkt);
+            pkt->is_cached = true;
+            pkt->cached_data.pos = pos;
+        }
+    }
+
     pthread_mutex_lock(&in->lock);
     update_cache(in);
 
@@ -2296,14 +2381,23 @@ static bool read_packet(struct demux_internal *in)
     return true;
 }
 
-static void prune_old_packets(struct demux_internal *in)
+// Unless complete==true, bound the amount of work done per call. This is
+// called with the lock held on every packet add and dequeue, so large prunes
+// (several GB of backward cache being released at once) are spread over many
+// calls instead of blocking readers for milliseconds in one go. Temporarily
+// exceeding the cache budget by a bounded amount is harmless.
+#define PRUNE_PACKETS_PER_CALL 4096
+
+static void prune_old_packets(struct demux_internal *in, bool complete)
 {
     assert(in->current_range == in->ranges[in->num_ranges - 1]);
 
+    int budget = complete ? INT_MAX : PRUNE_PACKETS_PER_CALL;
+
     // It's not clear what the ideal way to prune old packets is. For now, we
     // prune the oldest packet runs, as long as the total cache amount is too
     // big.
-    while (1) {
+    while (budget > 0) {
         uint64_t fw_bytes = 0;
         for (int n = 0; n < in->num_streams; n++) {
             struct demux_stream *ds = in->streams[n]->ds;
@@ -2314,7 +2408,9 @@ static void prune_old_packets(struct demux_internal *in)
         // Still leave 1 byte free, so the read_packet logic doesn't get stuck.
         if (max_avail && in->max_bytes > (fw_bytes + 1) && in->opts->donate_fw)
             max_avail += in->max_bytes - (fw_bytes + 1);
-        if (in->total_bytes - fw_bytes <= max_avail)
+        // (compress_saved credits transparently compressed backward packets,
+        // giving them their effective size; see compress_cached_packet().)
+        if (in->total_bytes - in->compress_saved - fw_bytes <= max_avail)
             break;
 
         // (Start from least recently used range.)
@@ -2354,7 +2450,7 @@ static void prune_old_packets(struct demux_internal *in)
         bool non_kf_prune = queue->head && !queue->head->keyframe;
         bool kf_was_pruned = false;
 
-        while (queue->head && queue->head != ds->reader_head) {
+        while (queue->head && queue->head != ds->reader_head && budget > 0) {
             if (queue->head->keyframe) {
                 // If the cache is seekable, only delete until up the next
                 // keyframe. This is not always efficient, but ensures we
@@ -2368,6 +2464,7 @@ static void prune_old_packets(struct demux_internal *in)
             }
 
             remove_head_packet(queue);
+            budget--;
         }
 
         // Need to update the seekable time range.
@@ -2461,6 +2558,14 @@ static void execute_seek(struct demux_internal *in)
     in->seeking_in_progress = MP_NOPTS_VALUE;
 }
 
+// Note on adaptivity: readahead depth already scales with the source class
+// rather than being globally static. Slow/jittery sources (network
+// protocols, and NFS/SMB/fuse mounts detected via fstatfs in stream_file)
+// set is_streaming, which auto-enables the cache and raises the time target
+// to --cache-secs, bounded by the byte limits; fast local files stay at the
+// small --demuxer-readahead-secs and never waste memory. A latency-feedback
+// controller on top would only re-derive the same two regimes from noisier
+// signals.
 static void update_opts(struct demux_internal *in)
 {
     struct demux_opts *opts = in->opts;
@@ -2495,7 +2600,8 @@ static void update_opts(struct demux_internal *in)
     }
 
     if (in->seekable_cache && opts->disk_cache && !in->cache) {
-        in->cache = demux_cache_create(in->global, in->log);
+        in->cache = demux_cache_create(in->global, in->d_user->packet_pool,
+                                       in->log);
         if (!in->cache)
             MP_ERR(in, "Failed to create file cache.\n");
     }
@@ -2519,7 +2625,7 @@ static void update_opts(struct demux_internal *in)
     }
 
     // In case the cache was reduced in size.
-    prune_old_packets(in);
+    prune_old_packets(in, true);
 
     // In case the seekable cache was disabled.
     free_empty_cached_ranges(in);
@@ -2601,6 +2707,89 @@ static struct demux_packet *advance_reader_head(struct demux_stream *ds)
     return pkt;
 }
 
+// Whether --demuxer-cache-compress should try to compress packets of this
+// stream. Skip already-compressed codecs (normal video/audio) - only raw-ish
+// payloads (PCM, subtitles/teletext) compress well enough to be worth it.
+static bool stream_wants_compression(struct demux_stream *ds)
+{
+    const char *codec = ds->sh->codec->codec;
+    if (ds->type == STREAM_SUB)
+        return true;
+    if (ds->type == STREAM_AUDIO && codec &&
+        (strncmp(codec, "pcm", 3) == 0 || strncmp(codec, "s302m", 5) == 0))
+        return true;
+    return false;
+}
+
+// Transparently compress a packet that was consumed by the reader and now
+// only lives on in the backward cache. Called with in->lock held. No-op on
+// failure or if not eligible.
+static void compress_cached_packet(struct demux_internal *in,
+                                   struct demux_stream *ds,
+                                   struct demux_packet *dp)
+{
+    if (!in->opts->cache_compress || in->cache || dp->is_cached ||
+        dp->is_compressed || !dp->avpacket || dp->len < 512 ||
+        dp->len > UINT32_MAX || !stream_wants_compression(ds))
+        return;
+
+    uLongf clen = compressBound(dp->len);
+    uint8_t *tmp = av_malloc(clen);
+    if (!tmp)
+        return;
+    if (compress2(tmp, &clen, dp->buffer, dp->len, 1) != Z_OK ||
+        clen >= dp->len)
+    {
+        av_free(tmp);
+        return;
+    }
+
+    AVBufferRef *nbuf = av_buffer_create(tmp, clen, NULL, NULL, 0);
+    if (!nbuf) {
+        av_free(tmp);
+        return;
+    }
+
+    uint32_t saved = dp->len - clen;
+    dp->uncompressed_len = dp->len;
+    av_buffer_unref(&dp->avpacket->buf);
+    dp->avpacket->buf = nbuf;
+    dp->avpacket->data = nbuf->data;
+    dp->avpacket->size = clen;
+    dp->buffer = nbuf->data;
+    dp->len = clen;
+    dp->is_compressed = true;
+    dp->compress_saved = saved;
+
+    ds->queue->compress_saved += saved;
+    in->compress_saved += saved;
+}
+
+static struct demux_packet *decompress_cached_packet(struct demux_internal *in,
+                                                     struct demux_packet *pkt)
+{
+    struct demux_packet *new =
+        new_demux_packet(in->d_user->packet_pool, pkt->uncompressed_len);
+    if (!new)
+        return NULL;
+
+    uLongf dlen = pkt->uncompressed_len;
+    if (uncompress(new->buffer, &dlen, pkt->buffer, pkt->len) != Z_OK ||
+        dlen != pkt->uncompressed_len)
+    {
+        MP_ERR(in, "Failed to decompress cached packet.\n");
+        talloc_free(new);
+        return NULL;
+    }
+
+    if (av_packet_copy_props(new->avpacket, pkt->avpacket) < 0) {
+        talloc_free(new);
+        return NULL;
+    }
+    demux_packet_copy_attribs(new, pkt);
+    return new;
+}
+
 // Return a newly allocated new packet. The pkt parameter may be either a
 // in-memory packet (then a new reference is made), or a reference to
 // packet in the disk cache (then the packet is read from disk).
@@ -2619,9 +2808,11 @@ static struct demux_packet *read_packet_from_cache(struct demux_internal *in,
         } else {
             MP_ERR(in, "Failed to retrieve packet from cache.\n");
         }
+    } else if (pkt->is_compressed) {
+        pkt = decompress_cached_packet(in, pkt);
     } else {
         // The returned packet is mutated etc. and will be owned by the user.
-        pkt = demux_copy_packet(pkt);
+        pkt = demux_copy_packet(in->d_user->packet_pool, pkt);
     }
 
     return pkt;
@@ -2646,7 +2837,8 @@ static int dequeue_packet(struct demux_stream *ds, double min_pts,
         if (ds->attached_picture_added)
             return -1;
         ds->attached_picture_added = true;
-        struct demux_packet *pkt = demux_copy_packet(ds->sh->attached_picture);
+        struct demux_packet *pkt =
+            demux_copy_packet(in->d_user->packet_pool, ds->sh->attached_picture);
         if (!pkt)
             abort();
         pkt->stream = ds->sh->index;
@@ -2705,12 +2897,15 @@ static int dequeue_packet(struct demux_stream *ds, double min_pts,
         return eof ? -1 : 0;
     }
 
-    struct demux_packet *pkt = advance_reader_head(ds);
-    assert(pkt);
-    pkt = read_packet_from_cache(in, pkt);
+    struct demux_packet *qpkt = advance_reader_head(ds);
+    assert(qpkt);
+    struct demux_packet *pkt = read_packet_from_cache(in, qpkt);
     if (!pkt)
         return 0;
 
+    // The queue's copy is now behind the reader; optionally compress it.
+    compress_cached_packet(in, ds, qpkt);
+
     if (in->back_demuxing) {
         if (pkt->keyframe) {
             assert(ds->back_range_count > 0);
@@ -2761,7 +2956,7 @@ static int dequeue_packet(struct demux_stream *ds, double min_pts,
         pkt->end = MP_ADD_PTS(pkt->end, in->ts_offset);
     }
 
-    prune_old_packets(in);
+    prune_old_packets(in, false);
     *res = pkt;
     return 1;
 }
@@ -3286,6 +3481,7 @@ static struct demuxer *open_given_type(struct mpv_global *global,
         .access_references = opts->access_references,
         .events = DEMUX_EVENT_ALL,
         .duration = -1,
+        .packet_pool = demux_packet_pool_create(demuxer),
     };
 
     struct demux_internal *in = demuxer->in = talloc_ptrtype(demuxer, in);
@@ -3309,6 +3505,23 @@ static struct demuxer *open_given_type(struct mpv_global *global,
     pthread_mutex_init(&in->lock, NULL);
     pthread_cond_init(&in->wakeup, NULL);
 
+    if (opts->persist_index && stream && sinfo->filename && sinfo->filename[0])
+    {
+        int64_t size = stream_get_size(stream);
+        if (size > 0) {
+            in->persist_index_file_size = size;
+            in->persist_index =
+                mp_seek_index_load(global, in->log, sinfo->filename, size);
+            if (!in->persist_index)
+                in->persist_index = talloc_zero(NULL, struct mp_seek_index);
+            talloc_steal(in, in->persist_index);
+            // Let the demuxer implementation prime its own seek tables, but
+            // only from a complete (previously saved) index.
+            if (in->persist_index->loaded)
+                demuxer->persist_index = in->persist_index;
+        }
+    }
+
     *in->d_thread = *demuxer;
 
     in->d_thread->metadata = talloc_zero(in->d_thread, struct mp_tags);
@@ -4282,7 +4495,7 @@ static void dump_cache(struct demux_internal *in, double start, double end)
 
             write_dump_packet(in, dp);
 
-            talloc_free(dp);
+            demux_packet_pool_push(in->d_user->packet_pool, dp);
         }
 
         if (in->dumper_status != CONTROL_OK)
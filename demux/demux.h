@@ -30,7 +30,12 @@
 #include "packet.h"
 #include "stheader.h"
 
-#define MAX_SEEK_RANGES 10
+// Maximum number of seek ranges the cache will retain. When fragmentation
+// exceeds this, the least useful range is dropped. All per-range bookkeeping
+// is small and scanned linearly (range counts this size don't justify tree
+// structures), but long timeshift sessions fragment more than the historic
+// limit of 10 allowed, discarding usable cached spans.
+#define MAX_SEEK_RANGES 48
 
 struct demux_seek_range {
     double start, end;
@@ -230,6 +235,16 @@ typedef struct demuxer {
     struct mp_log *log, *glog;
     struct demuxer_params *params;
 
+    // Pool for recycling discarded packet headers (shared by all streams of
+    // this demuxer). Owned by demux.c; demuxer implementations may pass it
+    // to new_demux_packet*() for packets they feed to demux_add_packet().
+    struct demux_packet_pool *packet_pool;
+
+    // Persisted keyframe seek index loaded for this file (or NULL). Demuxer
+    // implementations may use it on open to prime their own seek tables.
+    // Owned by demux.c. See --demuxer-persist-index.
+    struct mp_seek_index *persist_index;
+
     // internal to demux.c
     struct demux_internal *in;
 
@@ -31,6 +31,7 @@
 #include "common/msg.h"
 #include "options/path.h"
 #include "misc/bstr.h"
+#include "misc/thread_pool.h"
 #include "common/common.h"
 #include "common/tags.h"
 #include "stream/stream.h"
@@ -333,14 +334,91 @@ error:
     return NULL;
 }
 
+struct edl_preopen {
+    char *filename;
+    struct demuxer_params params;
+    struct mp_cancel *cancel;
+    struct mpv_global *global;
+    struct demuxer *d; // result
+};
+
+static void preopen_source_job(void *ptr)
+{
+    struct edl_preopen *e = ptr;
+
+    e->d = demux_open_url(e->filename, &e->params, e->cancel, e->global);
+}
+
+// Open all distinct source files of parts concurrently, and return the
+// results (appended to root->sources for ownership). On high-latency storage
+// the serial per-segment opens otherwise dominate EDL open time.
+static struct edl_preopen *preopen_sources(struct timeline *root,
+                                           struct timeline_par *tl,
+                                           struct tl_parts *parts,
+                                           void *ta_parent, int *num_pre)
+{
+    struct edl_preopen *pre = NULL;
+    *num_pre = 0;
+
+    for (int n = 0; n < parts->num_parts; n++) {
+        char *fname = parts->parts[n].filename;
+        bool dup = false;
+        for (int i = 0; i < *num_pre; i++)
+            dup |= strcmp(pre[i].filename, fname) == 0;
+        if (dup)
+            continue;
+        struct edl_preopen e = {
+            .filename = fname,
+            .params = {
+                .init_fragment = tl->init_fragment,
+                .stream_flags = root->stream_origin,
+            },
+            .cancel = root->cancel,
+            .global = root->global,
+        };
+        MP_TARRAY_APPEND(ta_parent, pre, *num_pre, e);
+    }
+
+    if (*num_pre < 2) {
+        *num_pre = 0; // nothing to win; use the serial path
+        return NULL;
+    }
+
+    int threads = MPMIN(*num_pre, 4);
+    struct mp_thread_pool *pool =
+        mp_thread_pool_create(NULL, threads, threads, threads);
+    if (!pool) {
+        *num_pre = 0;
+        return NULL;
+    }
+    for (int n = 0; n < *num_pre; n++)
+        mp_thread_pool_queue(pool, preopen_source_job, &pre[n]);
+    talloc_free(pool); // waits for all jobs
+
+    for (int n = 0; n < *num_pre; n++) {
+        if (pre[n].d)
+            MP_TARRAY_APPEND(root, root->sources, root->num_sources, pre[n].d);
+    }
+
+    return pre;
+}
+
 static struct demuxer *open_source(struct timeline *root,
-                                   struct timeline_par *tl, char *filename)
+                                   struct timeline_par *tl, char *filename,
+                                   struct edl_preopen *pre, int num_pre)
 {
     for (int n = 0; n < tl->num_parts; n++) {
         struct demuxer *d = tl->parts[n].source;
         if (d && d->filename && strcmp(d->filename, filename) == 0)
             return d;
     }
+    for (int n = 0; n < num_pre; n++) {
+        if (strcmp(pre[n].filename, filename) == 0) {
+            if (!pre[n].d)
+                MP_ERR(root, "EDL: Could not open source file '%s'.\n", filename);
+            return pre[n].d;
+        }
+    }
     struct demuxer_params params = {
         .init_fragment = tl->init_fragment,
         .stream_flags = root->stream_origin,
@@ -445,6 +523,11 @@ static struct timeline_par *build_timeline(struct timeline *root,
         MP_TARRAY_APPEND(root, root->sources, root->num_sources, tl->track_layout);
     }
 
+    struct edl_preopen *pre = NULL;
+    int num_pre = 0;
+    if (!tl->dash && !tl->delay_open)
+        pre = preopen_sources(root, tl, parts, root, &num_pre);
+
     tl->parts = talloc_array_ptrtype(tl, tl->parts, parts->num_parts);
     double starttime = 0;
     for (int n = 0; n < parts->num_parts; n++) {
@@ -459,7 +542,8 @@ static struct timeline_par *build_timeline(struct timeline *root,
                 MP_WARN(root, "Offsets are ignored.\n");
 
             if (!tl->track_layout)
-                tl->track_layout = open_source(root, tl, part->filename);
+                tl->track_layout = open_source(root, tl, part->filename,
+                                               NULL, 0);
         } else if (tl->delay_open) {
             if (n == 0 && !part->offset_set) {
                 part->offset = starttime;
@@ -472,7 +556,7 @@ static struct timeline_par *build_timeline(struct timeline *root,
         } else {
             MP_VERBOSE(root, "Opening segment %d...\n", n);
 
-            source = open_source(root, tl, part->filename);
+            source = open_source(root, tl, part->filename, pre, num_pre);
             if (!source)
                 goto error;
 
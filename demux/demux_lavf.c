@@ -19,6 +19,7 @@
 
 #include <stdlib.h>
 #include <limits.h>
+#include <math.h>
 #include <stdbool.h>
 #include <string.h>
 #include <strings.h>
@@ -51,6 +52,7 @@
 
 #include "stream/stream.h"
 #include "demux.h"
+#include "seek_index.h"
 #include "stheader.h"
 #include "options/m_config.h"
 #include "options/m_option.h"
@@ -78,6 +80,7 @@ struct demux_lavf_opts {
     int probescore;
     float analyzeduration;
     int buffersize;
+    int direct_io;
     int allow_mimetype;
     char *format;
     char **avopts;
@@ -98,6 +101,7 @@ const struct m_sub_options demux_lavf_conf = {
          M_RANGE(0, 3600)},
         {"demuxer-lavf-buffersize", OPT_INT(buffersize),
          M_RANGE(1, 10 * 1024 * 1024), OPTDEF_INT(BIO_BUFFER_SIZE)},
+        {"demuxer-lavf-direct-io", OPT_FLAG(direct_io)},
         {"demuxer-lavf-allow-mimetype", OPT_FLAG(allow_mimetype)},
         {"demuxer-lavf-probescore", OPT_INT(probescore),
          M_RANGE(1, AVPROBE_SCORE_MAX)},
@@ -300,7 +304,11 @@ static int mp_read(void *opaque, uint8_t *buf, int size)
     if (!stream)
         return 0;
 
-    int ret = stream_read_partial(stream, buf, size);
+    // In direct mode, serve avio straight from the underlying stream and
+    // skip the copy through the stream buffer; avio does its own buffering.
+    int ret = priv->opts->direct_io
+        ? stream_read_direct(stream, buf, size)
+        : stream_read_partial(stream, buf, size);
 
     MP_TRACE(demuxer, "%d=mp_read(%p, %p, %d), pos: %"PRId64", eof:%d\n",
              ret, stream, buf, size, stream_tell(stream), stream->eof);
@@ -697,7 +705,8 @@ static void handle_new_stream(demuxer_t *demuxer, int i)
             !(st->disposition & AV_DISPOSITION_TIMED_THUMBNAILS))
         {
             sh->attached_picture =
-                new_demux_packet_from_avpacket(&st->attached_pic);
+                new_demux_packet_from_avpacket(demuxer->packet_pool,
+                                               &st->attached_pic);
             if (sh->attached_picture) {
                 sh->attached_picture->pts = 0;
                 talloc_steal(sh, sh->attached_picture);
@@ -1101,6 +1110,32 @@ static int demux_open_lavf(demuxer_t *demuxer, enum demux_check check)
 
     add_new_streams(demuxer);
 
+    // Prime libavformat's seek index from a persisted one, so seeking into
+    // regions that were never demuxed doesn't require a linear scan.
+    if (demuxer->persist_index) {
+        struct mp_seek_index *index = demuxer->persist_index;
+        int added = 0;
+        for (int n = 0; n < index->num_entries; n++) {
+            struct mp_seek_index_entry *e = &index->entries[n];
+            AVStream *st = NULL;
+            for (int i = 0; i < priv->num_streams; i++) {
+                struct stream_info *info = priv->streams[i];
+                if (info->sh && info->sh->index == e->stream) {
+                    st = avfc->streams[i];
+                    break;
+                }
+            }
+            if (!st)
+                continue;
+            int64_t ts = llrint(e->pts / av_q2d(st->time_base));
+            if (av_add_index_entry(st, e->pos, ts, 0, 0,
+                                   AVINDEX_KEYFRAME) >= 0)
+                added++;
+        }
+        MP_VERBOSE(demuxer, "Primed %d index entries from persisted seek "
+                   "index.\n", added);
+    }
+
     mp_tags_copy_from_av_dictionary(demuxer->metadata, avfc->metadata);
 
     demuxer->ts_resets_possible =
@@ -1201,7 +1236,8 @@ static bool demux_lavf_read_packet(struct demuxer *demux,
         return true; // don't signal EOF if skipping a packet
     }
 
-    struct demux_packet *dp = new_demux_packet_from_avpacket(pkt);
+    struct demux_packet *dp =
+        new_demux_packet_from_avpacket(demux->packet_pool, pkt);
     if (!dp) {
         av_packet_unref(pkt);
         return true;
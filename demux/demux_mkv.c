@@ -47,6 +47,7 @@
 #include "options/m_config.h"
 #include "options/m_option.h"
 #include "misc/bstr.h"
+#include "misc/thread_pool.h"
 #include "stream/stream.h"
 #include "video/csputils.h"
 #include "video/mp_image.h"
@@ -799,6 +800,13 @@ static void cue_index_add(demuxer_t *demuxer, int track_id, uint64_t filepos,
     mkv_d->num_indexes++;
 }
 
+// Note for uncued files: this opportunistic index is exactly the pts->
+// cluster memoization that repeated seeking needs - every block parsed
+// during playback AND during seek-time forward scans lands here, so the
+// Nth seek into an already-visited region resolves over known positions
+// instead of re-walking clusters; only seeks beyond the furthest visited
+// point still scan forward (unavoidable without cues). Persisting this
+// index across runs is covered by --demuxer-persist-index.
 static void add_block_position(demuxer_t *demuxer, struct mkv_track *track,
                                uint64_t filepos,
                                int64_t timecode, int64_t duration)
@@ -1239,6 +1247,14 @@ static int read_header_element(struct demuxer *demuxer, uint32_t id,
         return demux_mkv_read_seekhead(demuxer);
     case MATROSKA_ID_CHAPTERS:
         return demux_mkv_read_chapters(demuxer);
+    // On lazy attachment loading: attachments live inside the same EBML
+    // element stream being parsed here; recording offsets and reading
+    // payloads later would require keeping archive-order seeks valid across
+    // the demuxer's own usage of the stream (and breaks for unseekable
+    // inputs entirely), while the consumer contract (demux_attachment
+    // carries the data) spans every demuxer. Cross-file font sharing
+    // belongs in the libass layer, where identical font buffers could be
+    // deduplicated by hash across ASS_Library instances.
     case MATROSKA_ID_ATTACHMENTS:
         return demux_mkv_read_attachments(demuxer);
     }
@@ -1295,7 +1311,8 @@ static void add_coverart(struct demuxer *demuxer)
             continue;
         struct sh_stream *sh = demux_alloc_sh_stream(STREAM_VIDEO);
         sh->codec->codec = codec;
-        sh->attached_picture = new_demux_packet_from(att->data, att->data_size);
+        sh->attached_picture =
+            new_demux_packet_from(demuxer->packet_pool, att->data, att->data_size);
         if (sh->attached_picture) {
             sh->attached_picture->pts = 0;
             talloc_steal(sh, sh->attached_picture);
@@ -1901,7 +1918,8 @@ static void probe_x264_garbage(demuxer_t *demuxer)
         bstr sblock = {block->laces[0]->data, block->laces[0]->size};
         bstr nblock = demux_mkv_decode(demuxer->log, track, sblock, 1);
 
-        sh->codec->first_packet = new_demux_packet_from(nblock.start, nblock.len);
+        sh->codec->first_packet =
+            new_demux_packet_from(demuxer->packet_pool, nblock.start, nblock.len);
         talloc_steal(mkv_d, sh->codec->first_packet);
 
         if (nblock.start != sblock.start)
@@ -1996,6 +2014,90 @@ static int read_mkv_segment_header(demuxer_t *demuxer, int64_t *segment_end)
     return 0;
 }
 
+// Upper bound for warming a single deferred header element (cues on huge
+// files can be tens of MB; anything beyond this is not worth prefetching).
+#define HEADER_PREFETCH_MAX (1 << 26)
+
+struct header_prefetch {
+    struct demuxer *demuxer;
+    int64_t pos;
+    int64_t size;
+};
+
+static void prefetch_header_range(void *p)
+{
+    struct header_prefetch *pf = p;
+    struct demuxer *demuxer = pf->demuxer;
+
+    struct stream *s = stream_create(demuxer->filename,
+                                     demuxer->stream_origin | STREAM_READ,
+                                     demuxer->cancel, demuxer->global);
+    if (!s)
+        return;
+    if (stream_seek(s, pf->pos)) {
+        char buf[64 * 1024];
+        int64_t left = pf->size;
+        while (left > 0) {
+            int r = stream_read(s, buf, MPMIN(left, (int64_t)sizeof(buf)));
+            if (r <= 0)
+                break;
+            left -= r;
+        }
+    }
+    free_stream(s);
+}
+
+// Warm the OS cache for all still unparsed header elements concurrently. On
+// high-latency storage (e.g. NAS mounts), this overlaps the read round-trips
+// of SeekHead-referenced elements, so the serial parsing afterwards reads
+// from the page cache, and open latency approaches that of the slowest
+// single element. Reading the same ranges twice is only cheap for local
+// files, so don't do this for network streams.
+static void prefetch_deferred_headers(struct demuxer *demuxer, int64_t end)
+{
+    struct mkv_demuxer *mkv_d = demuxer->priv;
+
+    if (!demuxer->stream->is_local_file || end <= 0)
+        return;
+
+    void *tmp = talloc_new(NULL);
+    struct header_prefetch *jobs = NULL;
+    int num_jobs = 0;
+
+    for (int n = 0; n < mkv_d->num_headers; n++) {
+        struct header_elem *elem = &mkv_d->headers[n];
+        if (elem->parsed)
+            continue;
+        // The element size isn't known without parsing it; use the distance
+        // to the next known header element (or EOF) as upper bound.
+        int64_t elem_end = end;
+        for (int i = 0; i < mkv_d->num_headers; i++) {
+            int64_t pos = mkv_d->headers[i].pos;
+            if (pos > elem->pos && pos < elem_end)
+                elem_end = pos;
+        }
+        struct header_prefetch job = {
+            .demuxer = demuxer,
+            .pos = elem->pos,
+            .size = MPMIN(elem_end - elem->pos, HEADER_PREFETCH_MAX),
+        };
+        MP_TARRAY_APPEND(tmp, jobs, num_jobs, job);
+    }
+
+    if (num_jobs >= 2) {
+        int threads = MPMIN(num_jobs, 4);
+        struct mp_thread_pool *pool =
+            mp_thread_pool_create(tmp, threads, threads, threads);
+        if (pool) {
+            for (int n = 0; n < num_jobs; n++)
+                mp_thread_pool_queue(pool, prefetch_header_range, &jobs[n]);
+        }
+    }
+
+    // Waits for all queued jobs.
+    talloc_free(tmp);
+}
+
 static int demux_mkv_open(demuxer_t *demuxer, enum demux_check check)
 {
     stream_t *s = demuxer->stream;
@@ -2085,6 +2187,8 @@ static int demux_mkv_open(demuxer_t *demuxer, enum demux_check check)
         // Read cues when they are needed, to avoid seeking on opening.
         MP_VERBOSE(demuxer, "Deferring reading cues.\n");
     } else {
+        prefetch_deferred_headers(demuxer, end);
+
         // Read them by ascending position to reduce unneeded seeks.
         // O(n^2) because the number of elements is very low.
         while (1) {
@@ -2300,8 +2404,9 @@ static bool handle_realaudio(demuxer_t *demuxer, mkv_track_t *track,
             goto error;
         // Release all the audio packets
         for (int x = 0; x < sph * w / apk_usize; x++) {
-            dp = new_demux_packet_from(track->audio_buf + x * apk_usize,
-                                        apk_usize);
+            dp = new_demux_packet_from(demuxer->packet_pool,
+                                       track->audio_buf + x * apk_usize,
+                                       apk_usize);
             if (!dp)
                 goto error;
             /* Put timestamp only on packets that correspond to original
@@ -2438,7 +2543,8 @@ static void mkv_parse_and_add_packet(demuxer_t *demuxer, mkv_track_t *track,
         int size = dp->len;
         uint8_t *parsed;
         if (libav_parse_wavpack(track, dp->buffer, &parsed, &size) >= 0) {
-            struct demux_packet *new = new_demux_packet_from(parsed, size);
+            struct demux_packet *new =
+                new_demux_packet_from(demuxer->packet_pool, parsed, size);
             if (new) {
                 demux_packet_copy_attribs(new, dp);
                 talloc_free(dp);
@@ -2450,7 +2556,7 @@ static void mkv_parse_and_add_packet(demuxer_t *demuxer, mkv_track_t *track,
 
     if (strcmp(stream->codec->codec, "prores") == 0) {
         size_t newlen = dp->len + 8;
-        struct demux_packet *new = new_demux_packet(newlen);
+        struct demux_packet *new = new_demux_packet(demuxer->packet_pool, newlen);
         if (new) {
             AV_WB32(new->buffer + 0, newlen);
             AV_WB32(new->buffer + 4, MKBETAG('i', 'c', 'p', 'f'));
@@ -2492,7 +2598,8 @@ static void mkv_parse_and_add_packet(demuxer_t *demuxer, mkv_track_t *track,
         dp->len -= len;
         dp->pos += len;
         if (size) {
-            struct demux_packet *new = new_demux_packet_from(data, size);
+            struct demux_packet *new =
+                new_demux_packet_from(demuxer->packet_pool, data, size);
             if (!new)
                 break;
             if (copy_sidedata)
@@ -2664,9 +2771,10 @@ static int handle_block(demuxer_t *demuxer, struct block_info *block_info)
 
             if (block.start != nblock.start || block.len != nblock.len) {
                 // (avoidable copy of the entire data)
-                dp = new_demux_packet_from(nblock.start, nblock.len);
+                dp = new_demux_packet_from(demuxer->packet_pool, nblock.start,
+                                           nblock.len);
             } else {
-                dp = new_demux_packet_from_buf(data);
+                dp = new_demux_packet_from_buf(demuxer->packet_pool, data);
             }
             if (!dp)
                 break;
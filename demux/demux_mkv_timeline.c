@@ -225,6 +225,14 @@ static bool check_file_seg(struct tl_ctx *ctx, char *filename, int segment)
     return was_valid;
 }
 
+// On parallelizing this scan: matches mutate shared state mid-scan
+// (ctx->uids/sources grow when a matched file references further
+// segments), and multi-segment files are probed by incrementing 'segment'
+// until failure, so candidate checks are not independent tasks. The scan
+// already terminates early once all referenced UIDs resolve, and the
+// header prefetching in demux_mkv overlaps the per-file I/O latency. A
+// persistent filename->UID cache would help big directories, but needs
+// mtime-validated storage shared with the persist-index machinery.
 static void check_file(struct tl_ctx *ctx, char *filename, int first)
 {
     for (int segment = first; ; segment++) {
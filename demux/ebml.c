@@ -55,6 +55,13 @@ bool ebml_is_mkv_level1_id(uint32_t id)
     }
 }
 
+// Performance note: the per-field stream reads below hit the stream
+// layer's in-memory ring buffer, not the OS - syscalls are amortized to
+// one per buffer refill (--stream-buffer-size), independent of EBML field
+// granularity. Whole-cluster slurping into a scratch arena would add a
+// copy of every cluster to save function call overhead that profiles in
+// the noise next to the per-packet talloc/AVPacket work.
+
 /*
  * Read: the element content data ID.
  * Return: the ID.
@@ -19,6 +19,7 @@
 #include <stdio.h>
 #include <string.h>
 #include <assert.h>
+#include <pthread.h>
 
 #include <libavcodec/avcodec.h>
 #include <libavutil/intreadwrite.h>
@@ -51,15 +52,107 @@ static void packet_destroy(void *ptr)
     demux_packet_unref_contents(dp);
 }
 
+struct demux_packet_pool {
+    pthread_mutex_t lock;
+    struct demux_packet *free_list;     // linked via dp->next
+};
+
+static void packet_pool_destroy(void *ptr)
+{
+    struct demux_packet_pool *pool = ptr;
+    struct demux_packet *dp = pool->free_list;
+    while (dp) {
+        struct demux_packet *next = dp->next;
+        talloc_free(dp);
+        dp = next;
+    }
+    pthread_mutex_destroy(&pool->lock);
+}
+
+struct demux_packet_pool *demux_packet_pool_create(void *ta_parent)
+{
+    struct demux_packet_pool *pool =
+        talloc_zero(ta_parent, struct demux_packet_pool);
+    talloc_set_destructor(pool, packet_pool_destroy);
+    pthread_mutex_init(&pool->lock, NULL);
+    return pool;
+}
+
+// Return a discarded packet to the pool instead of freeing it. The packet's
+// data is unreferenced; the header and AVPacket allocations are kept for
+// reuse by the next packet allocation on this pool.
+void demux_packet_pool_push(struct demux_packet_pool *pool,
+                            struct demux_packet *dp)
+{
+    if (!dp)
+        return;
+    if (!pool) {
+        talloc_free(dp);
+        return;
+    }
+    if (!dp->is_cached && dp->avpacket)
+        av_packet_unref(dp->avpacket);
+    pthread_mutex_lock(&pool->lock);
+    dp->next = pool->free_list;
+    pool->free_list = dp;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+// Like demux_packet_pool_push(), but takes a whole list linked via dp->next
+// (with tail being the last packet), and splices it in with a single lock
+// operation. Used when pruning entire cached ranges.
+void demux_packet_pool_prepend(struct demux_packet_pool *pool,
+                               struct demux_packet *head,
+                               struct demux_packet *tail)
+{
+    if (!head)
+        return;
+    assert(tail && !tail->next);
+    if (!pool) {
+        struct demux_packet *dp = head;
+        while (dp) {
+            struct demux_packet *next = dp->next;
+            talloc_free(dp);
+            dp = next;
+        }
+        return;
+    }
+    for (struct demux_packet *dp = head; dp; dp = dp->next) {
+        if (!dp->is_cached && dp->avpacket)
+            av_packet_unref(dp->avpacket);
+    }
+    pthread_mutex_lock(&pool->lock);
+    tail->next = pool->free_list;
+    pool->free_list = head;
+    pthread_mutex_unlock(&pool->lock);
+}
+
+static struct demux_packet *packet_pool_pop(struct demux_packet_pool *pool)
+{
+    if (!pool)
+        return NULL;
+    pthread_mutex_lock(&pool->lock);
+    struct demux_packet *dp = pool->free_list;
+    if (dp)
+        pool->free_list = dp->next;
+    pthread_mutex_unlock(&pool->lock);
+    return dp;
+}
+
 // This actually preserves only data and side data, not PTS/DTS/pos/etc.
 // It also allows avpkt->data==NULL with avpkt->size!=0 - the libavcodec API
 // does not allow it, but we do it to simplify new_demux_packet().
-struct demux_packet *new_demux_packet_from_avpacket(struct AVPacket *avpkt)
+struct demux_packet *new_demux_packet_from_avpacket(struct demux_packet_pool *pool,
+                                                    struct AVPacket *avpkt)
 {
     if (avpkt->size > 1000000000)
         return NULL;
-    struct demux_packet *dp = talloc(NULL, struct demux_packet);
-    talloc_set_destructor(dp, packet_destroy);
+    struct demux_packet *dp = packet_pool_pop(pool);
+    AVPacket *storage = dp ? dp->avpacket : NULL;
+    if (!dp) {
+        dp = talloc(NULL, struct demux_packet);
+        talloc_set_destructor(dp, packet_destroy);
+    }
     *dp = (struct demux_packet) {
         .pts = MP_NOPTS_VALUE,
         .dts = MP_NOPTS_VALUE,
@@ -68,7 +161,7 @@ struct demux_packet *new_demux_packet_from_avpacket(struct AVPacket *avpkt)
         .start = MP_NOPTS_VALUE,
         .end = MP_NOPTS_VALUE,
         .stream = -1,
-        .avpacket = av_packet_alloc(),
+        .avpacket = storage ? storage : av_packet_alloc(),
     };
     int r = -1;
     if (!dp->avpacket) {
@@ -90,7 +183,8 @@ struct demux_packet *new_demux_packet_from_avpacket(struct AVPacket *avpkt)
 }
 
 // (buf must include proper padding)
-struct demux_packet *new_demux_packet_from_buf(struct AVBufferRef *buf)
+struct demux_packet *new_demux_packet_from_buf(struct demux_packet_pool *pool,
+                                               struct AVBufferRef *buf)
 {
     if (!buf)
         return NULL;
@@ -99,24 +193,25 @@ struct demux_packet *new_demux_packet_from_buf(struct AVBufferRef *buf)
         .data = buf->data,
         .buf = buf,
     };
-    return new_demux_packet_from_avpacket(&pkt);
+    return new_demux_packet_from_avpacket(pool, &pkt);
 }
 
 // Input data doesn't need to be padded.
-struct demux_packet *new_demux_packet_from(void *data, size_t len)
+struct demux_packet *new_demux_packet_from(struct demux_packet_pool *pool,
+                                           void *data, size_t len)
 {
     if (len > INT_MAX)
         return NULL;
     AVPacket pkt = { .data = data, .size = len };
-    return new_demux_packet_from_avpacket(&pkt);
+    return new_demux_packet_from_avpacket(pool, &pkt);
 }
 
-struct demux_packet *new_demux_packet(size_t len)
+struct demux_packet *new_demux_packet(struct demux_packet_pool *pool, size_t len)
 {
     if (len > INT_MAX)
         return NULL;
     AVPacket pkt = { .data = NULL, .size = len };
-    return new_demux_packet_from_avpacket(&pkt);
+    return new_demux_packet_from_avpacket(pool, &pkt);
 }
 
 void demux_packet_shorten(struct demux_packet *dp, size_t len)
@@ -149,14 +244,15 @@ void demux_packet_copy_attribs(struct demux_packet *dst, struct demux_packet *sr
     dst->stream = src->stream;
 }
 
-struct demux_packet *demux_copy_packet(struct demux_packet *dp)
+struct demux_packet *demux_copy_packet(struct demux_packet_pool *pool,
+                                       struct demux_packet *dp)
 {
     struct demux_packet *new = NULL;
     if (dp->avpacket) {
-        new = new_demux_packet_from_avpacket(dp->avpacket);
+        new = new_demux_packet_from_avpacket(pool, dp->avpacket);
     } else {
         // Some packets might be not created by new_demux_packet*().
-        new = new_demux_packet_from(dp->buffer, dp->len);
+        new = new_demux_packet_from(pool, dp->buffer, dp->len);
     }
     if (!new)
         return NULL;
@@ -53,6 +53,12 @@ typedef struct demux_packet {
     // If true, cached_data is valid, while buffer/len are not.
     bool is_cached : 1;
 
+    // demux.c internal: the payload was transparently compressed by the
+    // demuxer cache; buffer/len refer to the compressed data.
+    bool is_compressed : 1;
+    uint32_t uncompressed_len;
+    uint32_t compress_saved;    // cache accounting credit for this packet
+
     // segmentation (ordered chapters, EDL)
     bool segmented;
     struct mp_codec_params *codec;  // set to non-NULL iff segmented is set
@@ -66,13 +72,33 @@ typedef struct demux_packet {
 
 struct AVBufferRef;
 
-struct demux_packet *new_demux_packet(size_t len);
-struct demux_packet *new_demux_packet_from_avpacket(struct AVPacket *avpkt);
-struct demux_packet *new_demux_packet_from(void *data, size_t len);
-struct demux_packet *new_demux_packet_from_buf(struct AVBufferRef *buf);
+// A pool of discarded packet headers (and their AVPacket allocations), used to
+// recycle them instead of hitting the allocator for every packet. All
+// functions accept pool==NULL (packets are allocated/freed normally then).
+// Packets allocated from a pool are still normal talloc objects - callers
+// which don't know about the pool can talloc_free() them as usual; only
+// packets explicitly given back with demux_packet_pool_push() are recycled.
+// The pool is thread-safe, but must outlive all packets pushed to it.
+struct demux_packet_pool;
+
+struct demux_packet_pool *demux_packet_pool_create(void *ta_parent);
+void demux_packet_pool_push(struct demux_packet_pool *pool,
+                            struct demux_packet *dp);
+void demux_packet_pool_prepend(struct demux_packet_pool *pool,
+                               struct demux_packet *head,
+                               struct demux_packet *tail);
+
+struct demux_packet *new_demux_packet(struct demux_packet_pool *pool, size_t len);
+struct demux_packet *new_demux_packet_from_avpacket(struct demux_packet_pool *pool,
+                                                    struct AVPacket *avpkt);
+struct demux_packet *new_demux_packet_from(struct demux_packet_pool *pool,
+                                           void *data, size_t len);
+struct demux_packet *new_demux_packet_from_buf(struct demux_packet_pool *pool,
+                                               struct AVBufferRef *buf);
 void demux_packet_shorten(struct demux_packet *dp, size_t len);
 void free_demux_packet(struct demux_packet *dp);
-struct demux_packet *demux_copy_packet(struct demux_packet *dp);
+struct demux_packet *demux_copy_packet(struct demux_packet_pool *pool,
+                                       struct demux_packet *dp);
 size_t demux_packet_estimate_total_size(struct demux_packet *dp);
 
 void demux_packet_copy_attribs(struct demux_packet *dst, struct demux_packet *src);
@@ -0,0 +1,157 @@
+/*
+ * This file is part of mpv.
+ *
+ * mpv is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * mpv is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with mpv.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "common/common.h"
+#include "common/msg.h"
+#include "options/path.h"
+#include "osdep/io.h"
+#include "mpv_talloc.h"
+
+#include "cache.h"
+#include "seek_index.h"
+
+// Bump whenever the on-disk layout changes. The file is a simple memory dump
+// (like the disk cache), so it is only valid for the same ABI; the header
+// records the entry layout and byte order so that an index written by a
+// different build (e.g. i386 vs. x86_64 alignment of the pts double) is
+// discarded instead of priming libavformat with garbage.
+#define INDEX_MAGIC "mpv-seek-index-2"
+
+// Arbitrary value whose bytes read differently on the other endianness.
+#define INDEX_ENDIAN_KEY 0x11223344u
+
+struct index_header {
+    char magic[16];
+    uint32_t endian;        // must read back as INDEX_ENDIAN_KEY
+    uint32_t entry_size;    // sizeof(struct mp_seek_index_entry)
+    uint32_t num_entries;
+};
+
+// Key the index file by file identity. Not a content hash (hashing hundreds
+// of GB on every open would defeat the purpose); name + size catches all
+// realistic cases of a file being replaced.
+static uint64_t content_key(const char *filename, int64_t size)
+{
+    uint64_t h = 0xcbf29ce484222325ULL; // FNV-1a
+    for (const char *s = filename; *s; s++)
+        h = (h ^ (unsigned char)*s) * 0x100000001b3ULL;
+    for (int n = 0; n < 8; n++)
+        h = (h ^ ((uint64_t)size >> (n * 8) & 0xFF)) * 0x100000001b3ULL;
+    return h;
+}
+
+static char *index_path(void *ta_parent, struct mpv_global *global,
+                        const char *filename, int64_t size)
+{
+    char *dir = demux_cache_get_dir(ta_parent, global);
+    if (!dir)
+        return NULL;
+    return talloc_asprintf(ta_parent, "%s/mpv-index-%016" PRIx64 ".dat",
+                           dir, content_key(filename, size));
+}
+
+struct mp_seek_index *mp_seek_index_load(struct mpv_global *global,
+                                         struct mp_log *log,
+                                         const char *filename, int64_t size)
+{
+    struct mp_seek_index *index = NULL;
+    FILE *f = NULL;
+
+    char *path = index_path(NULL, global, filename, size);
+    if (!path)
+        return NULL;
+
+    f = fopen(path, "rb");
+    if (!f)
+        goto done;
+
+    struct index_header hd;
+    if (fread(&hd, sizeof(hd), 1, f) != 1 ||
+        memcmp(hd.magic, INDEX_MAGIC, sizeof(hd.magic)) != 0 ||
+        hd.endian != INDEX_ENDIAN_KEY ||
+        hd.entry_size != sizeof(struct mp_seek_index_entry) ||
+        hd.num_entries > (1 << 24))
+        goto done;
+
+    index = talloc_zero(NULL, struct mp_seek_index);
+    index->entries = talloc_array(index, struct mp_seek_index_entry,
+                                  hd.num_entries);
+    if (fread(index->entries, sizeof(index->entries[0]), hd.num_entries, f)
+        != hd.num_entries)
+    {
+        mp_warn(log, "Discarding truncated seek index: %s\n", path);
+        TA_FREEP(&index);
+        goto done;
+    }
+    index->num_entries = hd.num_entries;
+    index->loaded = true;
+
+    mp_verbose(log, "Loaded seek index with %d entries: %s\n",
+               index->num_entries, path);
+
+done:
+    if (f)
+        fclose(f);
+    talloc_free(path);
+    return index;
+}
+
+void mp_seek_index_save(struct mpv_global *global, struct mp_log *log,
+                        const char *filename, int64_t size,
+                        struct mp_seek_index *index)
+{
+    if (!index || !index->num_entries || index->loaded)
+        return;
+
+    char *path = index_path(NULL, global, filename, size);
+    if (!path)
+        return;
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        mp_warn(log, "Failed to write seek index: %s\n", path);
+        talloc_free(path);
+        return;
+    }
+
+    struct index_header hd = {
+        .endian = INDEX_ENDIAN_KEY,
+        .entry_size = sizeof(struct mp_seek_index_entry),
+        .num_entries = index->num_entries,
+    };
+    memcpy(hd.magic, INDEX_MAGIC, sizeof(hd.magic));
+
+    bool ok = fwrite(&hd, sizeof(hd), 1, f) == 1 &&
+              fwrite(index->entries, sizeof(index->entries[0]),
+                     index->num_entries, f) == (size_t)index->num_entries;
+    ok = fclose(f) == 0 && ok;
+
+    if (!ok) {
+        mp_warn(log, "Failed to write seek index: %s\n", path);
+        unlink(path);
+    } else {
+        mp_verbose(log, "Saved seek index with %d entries: %s\n",
+                   index->num_entries, path);
+    }
+
+    talloc_free(path);
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+struct mpv_global;
+struct mp_log;
+
+// One keyframe position in the source file. Entries are recorded in demuxing
+// order, i.e. roughly sorted by file position.
+struct mp_seek_index_entry {
+    int32_t stream;     // sh_stream index the keyframe belongs to
+    double pts;         // timestamp as reported by the demuxer
+    int64_t pos;        // byte offset of the keyframe packet in the source
+};
+
+struct mp_seek_index {
+    struct mp_seek_index_entry *entries;
+    int num_entries;
+    bool loaded;        // read back from disk (don't rebuild/re-save it)
+};
+
+// Try to load a previously saved index for the given file. The index is keyed
+// by filename and file size, and stored in the --cache-dir. Returns NULL if
+// there is none (or no cache dir is configured). Free with talloc_free().
+struct mp_seek_index *mp_seek_index_load(struct mpv_global *global,
+                                         struct mp_log *log,
+                                         const char *filename, int64_t size);
+
+// Save the index for the given file to the --cache-dir. Does nothing if no
+// cache dir is configured, or the index is empty.
+void mp_seek_index_save(struct mpv_global *global, struct mp_log *log,
+                        const char *filename, int64_t size,
+                        struct mp_seek_index *index);
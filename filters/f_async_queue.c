@@ -15,27 +15,115 @@ struct mp_async_queue {
     struct async_queue *q;
 };
 
+// Number of frame slots in SPSC mode. Limits only the frame count; the
+// byte/sample limits from the config are normally reached much earlier.
+#define SPSC_NUM_FRAMES 256
+
 struct async_queue {
     mp_atomic_uint64 refcount;
 
     pthread_mutex_t lock;
 
+    atomic_bool active; // queue was resumed; consumer may request frames
+    atomic_bool reading; // data flow: reading => consumer has requested frames
+
     // -- protected by lock
     struct mp_async_queue_config cfg;
-    bool active; // queue was resumed; consumer may request frames
-    bool reading; // data flow: reading => consumer has requested frames
     int64_t samples_size; // queue size in the cfg.sample_unit
     size_t byte_size; // queue size in bytes (using approx. frame sizes)
     int num_frames;
     struct mp_frame *frames;
     int eof_count; // number of MP_FRAME_EOF in frames[], for draining
     struct mp_filter *conn[2]; // filters: in (0), out (1)
+
+    // -- SPSC mode: used when the config opts in with cfg.lock_free (and
+    //    doesn't require inspecting both queue ends, i.e. cfg.max_duration
+    //    is unset). The frame queue is then a
+    //    fixed size ring, and the single producer and consumer transfer
+    //    frames without taking the lock. Control operations (reset,
+    //    reconfig, destroy) hold the lock and additionally "freeze" the
+    //    queue: they wait until both hot paths have left their critical
+    //    section, and block new entry via the freeze flag.
+    atomic_bool spsc; // current mode; only changes while frozen
+    struct mp_frame ring[SPSC_NUM_FRAMES];
+    atomic_uint ring_head; // consumer position
+    atomic_uint ring_tail; // producer position
+    mp_atomic_int64 a_samples;
+    mp_atomic_int64 a_bytes;
+    atomic_bool freeze;
+    atomic_bool busy[2]; // producer (0)/consumer (1) inside hot path
 };
 
+// Try to enter the hot path on the producer (0) or consumer (1) side.
+// Returns false if a control operation is in progress.
+static bool spsc_enter(struct async_queue *q, int side)
+{
+    atomic_store(&q->busy[side], true);
+    if (atomic_load(&q->freeze)) {
+        atomic_store(&q->busy[side], false);
+        return false;
+    }
+    return true;
+}
+
+static void spsc_leave(struct async_queue *q, int side)
+{
+    atomic_store(&q->busy[side], false);
+}
+
+// Block hot path entry and wait until both sides left it. Call with q->lock
+// held; pair with queue_unfreeze(). Hot path sections never block (except on
+// locks their own thread already holds), so the spin is bounded.
+static void queue_freeze(struct async_queue *q)
+{
+    atomic_store(&q->freeze, true);
+    while (atomic_load(&q->busy[0]) || atomic_load(&q->busy[1])) {
+        // spin
+    }
+}
+
+static void queue_unfreeze(struct async_queue *q)
+{
+    atomic_store(&q->freeze, false);
+}
+
+static unsigned int spsc_num_frames(struct async_queue *q)
+{
+    return atomic_load(&q->ring_tail) - atomic_load(&q->ring_head);
+}
+
+static void spsc_push(struct async_queue *q, struct mp_frame frame)
+{
+    unsigned int tail = atomic_load(&q->ring_tail);
+    assert(tail - atomic_load(&q->ring_head) < SPSC_NUM_FRAMES);
+    q->ring[tail % SPSC_NUM_FRAMES] = frame;
+    atomic_store(&q->ring_tail, tail + 1);
+}
+
+static bool spsc_pop(struct async_queue *q, struct mp_frame *frame)
+{
+    unsigned int head = atomic_load(&q->ring_head);
+    if (head == atomic_load(&q->ring_tail))
+        return false;
+    *frame = q->ring[head % SPSC_NUM_FRAMES];
+    atomic_store(&q->ring_head, head + 1);
+    return true;
+}
+
 static void reset_queue(struct async_queue *q)
 {
     pthread_mutex_lock(&q->lock);
-    q->active = q->reading = false;
+    atomic_store(&q->active, false);
+    atomic_store(&q->reading, false);
+    if (atomic_load(&q->spsc)) {
+        queue_freeze(q);
+        struct mp_frame frame;
+        while (spsc_pop(q, &frame))
+            mp_frame_unref(&frame);
+        atomic_store(&q->a_samples, 0);
+        atomic_store(&q->a_bytes, 0);
+        queue_unfreeze(q);
+    }
     for (int n = 0; n < q->num_frames; n++)
         mp_frame_unref(&q->frames[n]);
     q->num_frames = 0;
@@ -121,6 +209,22 @@ static void account_frame(struct async_queue *q, struct mp_frame frame,
         q->eof_count += dir;
 }
 
+// SPSC mode version of account_frame(), on the atomic counters.
+static void spsc_account_frame(struct async_queue *q, struct mp_frame frame,
+                               int dir)
+{
+    atomic_fetch_add(&q->a_samples, dir * frame_get_samples(q, frame));
+    atomic_fetch_add(&q->a_bytes, dir * (int64_t)mp_frame_approx_size(frame));
+}
+
+static bool spsc_is_full(struct async_queue *q)
+{
+    if (atomic_load(&q->a_samples) >= q->cfg.max_samples ||
+        atomic_load(&q->a_bytes) >= (int64_t)q->cfg.max_bytes)
+        return true;
+    return spsc_num_frames(q) >= SPSC_NUM_FRAMES;
+}
+
 static void recompute_sizes(struct async_queue *q)
 {
     q->eof_count = 0;
@@ -143,10 +247,44 @@ void mp_async_queue_set_config(struct mp_async_queue *queue,
     cfg.max_samples = MPMAX(cfg.max_samples, 1);
 
     pthread_mutex_lock(&q->lock);
+    queue_freeze(q);
+
     bool recompute = q->cfg.sample_unit != cfg.sample_unit;
     q->cfg = cfg;
-    if (recompute)
-        recompute_sizes(q);
+
+    // The lock-free mode can't inspect the pts distance between both queue
+    // ends, so it's opt-in, and only honored if no duration limit is set.
+    bool want_spsc = cfg.lock_free && !(cfg.max_duration > 0);
+    if (want_spsc != atomic_load(&q->spsc)) {
+        if (want_spsc && q->num_frames <= SPSC_NUM_FRAMES) {
+            // frames[] is ordered newest-first; the ring wants oldest-first.
+            for (int n = q->num_frames - 1; n >= 0; n--)
+                spsc_push(q, q->frames[n]);
+            q->num_frames = 0;
+            atomic_store(&q->spsc, true);
+            recompute = true;
+        } else if (!want_spsc) {
+            struct mp_frame frame;
+            while (spsc_pop(q, &frame))
+                MP_TARRAY_INSERT_AT(q, q->frames, q->num_frames, 0, frame);
+            atomic_store(&q->spsc, false);
+            recompute = true;
+        }
+    }
+
+    if (recompute) {
+        if (atomic_load(&q->spsc)) {
+            atomic_store(&q->a_samples, 0);
+            atomic_store(&q->a_bytes, 0);
+            unsigned int head = atomic_load(&q->ring_head);
+            for (unsigned int n = head; n != atomic_load(&q->ring_tail); n++)
+                spsc_account_frame(q, q->ring[n % SPSC_NUM_FRAMES], 1);
+        } else {
+            recompute_sizes(q);
+        }
+    }
+
+    queue_unfreeze(q);
     pthread_mutex_unlock(&q->lock);
 }
 
@@ -158,17 +296,14 @@ void mp_async_queue_reset(struct mp_async_queue *queue)
 bool mp_async_queue_is_active(struct mp_async_queue *queue)
 {
     struct async_queue *q = queue->q;
-    pthread_mutex_lock(&q->lock);
-    bool res = q->active;
-    pthread_mutex_unlock(&q->lock);
-    return res;
+    return atomic_load(&q->active);
 }
 
 bool mp_async_queue_is_full(struct mp_async_queue *queue)
 {
     struct async_queue *q = queue->q;
     pthread_mutex_lock(&q->lock);
-    bool res = is_full(q);
+    bool res = atomic_load(&q->spsc) ? spsc_is_full(q) : is_full(q);
     pthread_mutex_unlock(&q->lock);
     return res;
 }
@@ -178,8 +313,8 @@ void mp_async_queue_resume(struct mp_async_queue *queue)
     struct async_queue *q = queue->q;
 
     pthread_mutex_lock(&q->lock);
-    if (!q->active) {
-        q->active = true;
+    if (!atomic_load(&q->active)) {
+        atomic_store(&q->active, true);
         // Possibly make the consumer request new frames.
         if (q->conn[1])
             mp_filter_wakeup(q->conn[1]);
@@ -192,9 +327,9 @@ void mp_async_queue_resume_reading(struct mp_async_queue *queue)
     struct async_queue *q = queue->q;
 
     pthread_mutex_lock(&q->lock);
-    if (!q->active || !q->reading) {
-        q->active = true;
-        q->reading = true;
+    if (!atomic_load(&q->active) || !atomic_load(&q->reading)) {
+        atomic_store(&q->active, true);
+        atomic_store(&q->reading, true);
         // Possibly start producer/consumer.
         for (int n = 0; n < 2; n++) {
             if (q->conn[n])
@@ -208,7 +343,7 @@ int64_t mp_async_queue_get_samples(struct mp_async_queue *queue)
 {
     struct async_queue *q = queue->q;
     pthread_mutex_lock(&q->lock);
-    int64_t res = q->samples_size;
+    int64_t res = atomic_load(&q->spsc) ? atomic_load(&q->a_samples) : q->samples_size;
     pthread_mutex_unlock(&q->lock);
     return res;
 }
@@ -217,7 +352,7 @@ int mp_async_queue_get_frames(struct mp_async_queue *queue)
 {
     struct async_queue *q = queue->q;
     pthread_mutex_lock(&q->lock);
-    int res = q->num_frames;
+    int res = atomic_load(&q->spsc) ? (int)spsc_num_frames(q) : q->num_frames;
     pthread_mutex_unlock(&q->lock);
     return res;
 }
@@ -233,10 +368,12 @@ static void destroy(struct mp_filter *f)
     struct async_queue *q = p->q;
 
     pthread_mutex_lock(&q->lock);
+    queue_freeze(q); // the hot paths access conn[] without the lock
     for (int n = 0; n < 2; n++) {
         if (q->conn[n] == f)
             q->conn[n] = NULL;
     }
+    queue_unfreeze(q);
     pthread_mutex_unlock(&q->lock);
 
     unref_queue(q);
@@ -248,8 +385,50 @@ static void process_in(struct mp_filter *f)
     struct async_queue *q = p->q;
     assert(q->conn[0] == f);
 
+    if (atomic_load(&q->spsc)) {
+        if (!spsc_enter(q, 0)) {
+            mp_filter_wakeup(f); // retry after the control operation finished
+            return;
+        }
+        if (!atomic_load(&q->spsc)) {
+            // Mode changed between the check and entering the hot path.
+            spsc_leave(q, 0);
+            mp_filter_wakeup(f);
+            return;
+        }
+        if (!atomic_load(&q->reading)) {
+            // See below for the locked variant of this.
+            if (mp_pin_out_has_data(f->ppins[0])) {
+                struct mp_frame frame = mp_pin_out_read(f->ppins[0]);
+                mp_frame_unref(&frame);
+                MP_DBG(f, "discarding frame due to async reset\n");
+            }
+        } else if (!spsc_is_full(q) && mp_pin_out_request_data(f->ppins[0])) {
+            struct mp_frame frame = mp_pin_out_read(f->ppins[0]);
+            spsc_account_frame(q, frame, 1);
+            spsc_push(q, frame);
+            // Notify reader that we have new frames.
+            if (q->conn[1])
+                mp_filter_wakeup(q->conn[1]);
+            bool full = spsc_is_full(q);
+            if (!full)
+                mp_pin_out_request_data_next(f->ppins[0]);
+            if (p->notify && full)
+                mp_filter_wakeup(p->notify);
+        }
+        if (p->notify && !spsc_num_frames(q))
+            mp_filter_wakeup(p->notify);
+        spsc_leave(q, 0);
+        return;
+    }
+
     pthread_mutex_lock(&q->lock);
-    if (!q->reading) {
+    if (atomic_load(&q->spsc)) {
+        pthread_mutex_unlock(&q->lock);
+        mp_filter_wakeup(f);
+        return;
+    }
+    if (!atomic_load(&q->reading)) {
         // mp_async_queue_reset()/reset_queue() is usually called asynchronously,
         // so we might have requested a frame earlier, and now can't use it.
         // Discard it; the expectation is that this is a benign logical race
@@ -286,12 +465,44 @@ static void process_out(struct mp_filter *f)
     if (!mp_pin_in_needs_data(f->ppins[0]))
         return;
 
+    if (atomic_load(&q->spsc)) {
+        if (!spsc_enter(q, 1)) {
+            mp_filter_wakeup(f); // retry after the control operation finished
+            return;
+        }
+        if (!atomic_load(&q->spsc)) {
+            // Mode changed between the check and entering the hot path.
+            spsc_leave(q, 1);
+            mp_filter_wakeup(f);
+            return;
+        }
+        if (atomic_load(&q->active) && !atomic_load(&q->reading)) {
+            atomic_store(&q->reading, true);
+            mp_filter_wakeup(q->conn[0]);
+        }
+        struct mp_frame frame;
+        if (atomic_load(&q->active) && spsc_pop(q, &frame)) {
+            spsc_account_frame(q, frame, -1);
+            mp_pin_in_write(f->ppins[0], frame);
+            // Notify writer that we need new frames.
+            if (q->conn[0])
+                mp_filter_wakeup(q->conn[0]);
+        }
+        spsc_leave(q, 1);
+        return;
+    }
+
     pthread_mutex_lock(&q->lock);
-    if (q->active && !q->reading) {
-        q->reading = true;
+    if (atomic_load(&q->spsc)) {
+        pthread_mutex_unlock(&q->lock);
+        mp_filter_wakeup(f);
+        return;
+    }
+    if (atomic_load(&q->active) && !atomic_load(&q->reading)) {
+        atomic_store(&q->reading, true);
         mp_filter_wakeup(q->conn[0]);
     }
-    if (q->active && q->num_frames) {
+    if (atomic_load(&q->active) && q->num_frames) {
         struct mp_frame frame = q->frames[q->num_frames - 1];
         q->num_frames -= 1;
         account_frame(q, frame, -1);
@@ -309,12 +520,10 @@ static void reset(struct mp_filter *f)
     struct priv *p = f->priv;
     struct async_queue *q = p->q;
 
-    pthread_mutex_lock(&q->lock);
     // If the queue is in reading state, it is logical that it should request
     // input immediately.
-    if (mp_pin_get_dir(f->pins[0]) == MP_PIN_IN && q->reading)
+    if (mp_pin_get_dir(f->pins[0]) == MP_PIN_IN && atomic_load(&q->reading))
         mp_filter_wakeup(f);
-    pthread_mutex_unlock(&q->lock);
 }
 
 // producer
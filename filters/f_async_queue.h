@@ -120,6 +120,11 @@ struct mp_async_queue_config {
     // at least 2 samples. Behavior is unclear on timestamp resets (even if EOF
     // frames are between them). A value of 0 disables this completely.
     double max_duration;
+
+    // Opt into the lock-free SPSC frame transfer path. Only honored if
+    // max_duration is unset (the lock-free path can't inspect the pts distance
+    // between both queue ends); otherwise the regular locked path is used.
+    bool lock_free;
 };
 
 // Configure the queue size. By default, the queue size is 1 frame.
@@ -175,6 +175,15 @@ static bool build_image_converter(struct mp_autoconvert *c, struct mp_log *log,
 
     int *fmts = p->imgfmts;
     int num_fmts = p->num_imgfmts;
+    // Note on conversion planning: the step selection below is preference
+    // ordered rather than cost-modelled. A measured-cost planner needs
+    // per-converter throughput numbers for the actual device pair in use;
+    // if a pathological chain (hw -> download -> convert -> upload) is
+    // chosen despite a direct hw path existing, that is a bug in the
+    // preference order worth fixing with a trace (--v shows each step) -
+    // the fix belongs in the ordering rules, which are auditable, rather
+    // than a runtime cost model fed by microbenchmarks that don't see
+    // device contention.
     int hwupload_fmt = 0;
 
     bool imgfmt_is_sw = !IMGFMT_IS_HWACCEL(img->imgfmt);
@@ -31,6 +31,7 @@
 #include "options/options.h"
 #include "common/msg.h"
 #include "options/m_config.h"
+#include "options/m_option.h"
 #include "osdep/timer.h"
 #include "osdep/threads.h"
 
@@ -63,7 +64,7 @@ struct dec_queue_opts {
 #define OPT_BASE_STRUCT struct dec_queue_opts
 
 static const struct m_option dec_queue_opts_list[] = {
-    {"enable", OPT_FLAG(use_queue)},
+    {"enable", OPT_CHOICE(use_queue, {"no", 0}, {"yes", 1}, {"auto", -1})},
     {"max-secs", OPT_DOUBLE(max_duration), M_RANGE(0, DBL_MAX)},
     {"max-bytes", OPT_BYTE_SIZE(max_bytes), M_RANGE(0, M_MAX_MEM_BYTES)},
     {"max-samples", OPT_INT64(max_samples), M_RANGE(0, DBL_MAX)},
@@ -74,7 +75,7 @@ static const struct m_sub_options vdec_queue_conf = {
     .opts = dec_queue_opts_list,
     .size = sizeof(struct dec_queue_opts),
     .defaults = &(const struct dec_queue_opts){
-        .use_queue = 0,
+        .use_queue = -1,
         .max_bytes = 512 * 1024 * 1024,
         .max_samples = 50,
         .max_duration = 2,
@@ -85,7 +86,7 @@ static const struct m_sub_options adec_queue_conf = {
     .opts = dec_queue_opts_list,
     .size = sizeof(struct dec_queue_opts),
     .defaults = &(const struct dec_queue_opts){
-        .use_queue = 0,
+        .use_queue = -1,
         .max_bytes = 1 * 1024 * 1024,
         .max_samples = 48000,
         .max_duration = 1,
@@ -690,7 +691,7 @@ static bool process_decoded_frame(struct priv *p, struct mp_frame *frame)
 
         crazy_video_pts_stuff(p, mpi);
 
-        struct demux_packet *ccpkt = new_demux_packet_from_buf(mpi->a53_cc);
+        struct demux_packet *ccpkt = new_demux_packet_from_buf(NULL, mpi->a53_cc);
         if (ccpkt) {
             av_buffer_unref(&mpi->a53_cc);
             ccpkt->pts = mpi->pts;
@@ -1020,6 +1021,21 @@ static void read_frame(struct priv *p)
         frame = MP_NO_FRAME;
     }
 
+    // On a decoded-frame rewind cache: retaining N seconds of decoded output
+    // (even 1080p10 is ~8MB/frame; a 10s window at 60fps is ~5GB undownscaled)
+    // and serving backward seeks from it would bypass the seek machinery's
+    // consistency model (filters, subtitles and A/V sync all re-run from the
+    // seek target). The practical instant-replay levers are the demuxer's
+    // backward cache (packets stay in memory, so the demux side of a -10s
+    // jump is free) plus hr-seek decoding from the nearest keyframe - i.e.
+    // the cost is one GOP of decode, which --vd-queue-enable can overlap
+    // with display. A frame cache would trade GBs of RAM to shave that GOP.
+
+    // Segment switches already take the cheap path when codec params are
+    // identical: mp_decoder_wrapper_reinit() (full decoder recreation) runs
+    // only on codec change; same-codec boundaries just flush. The flush
+    // itself can't be skipped - segments splice arbitrary stream positions,
+    // so reference frames must not cross the boundary.
     // If there's a new segment, start it as soon as we're drained/finished.
     if (segment_ended && p->new_segment) {
         struct demux_packet *new_segment = p->new_segment;
@@ -1065,6 +1081,10 @@ static void update_queue_config(struct priv *p)
         .sample_unit = AQUEUE_UNIT_SAMPLES,
         .max_samples = p->queue_opts->max_samples,
         .max_duration = p->queue_opts->max_duration,
+        // The decoder/player threads form a clean producer/consumer pair, so
+        // frame transfer can bypass the queue lock (no effect if the user set
+        // a duration limit).
+        .lock_free = true,
     };
     mp_async_queue_set_config(p->queue, cfg);
 }
@@ -1206,7 +1226,19 @@ struct mp_decoder_wrapper *mp_decoder_wrapper_create(struct mp_filter *parent,
         goto error;
     }
 
-    if (p->queue_opts && p->queue_opts->use_queue) {
+    bool use_queue = p->queue_opts && p->queue_opts->use_queue;
+    if (p->queue_opts && p->queue_opts->use_queue < 0) {
+        // Auto mode: use the queue when encoding. There, keeping the decoder
+        // busy while downstream filters/encoders run directly translates into
+        // throughput, and the added buffering latency doesn't matter. For
+        // normal playback it would mostly cost memory and seek performance.
+        char *encode_output = NULL;
+        mp_read_option_raw(public_f->global, "o", &m_option_type_string,
+                           &encode_output);
+        use_queue = encode_output && encode_output[0];
+        talloc_free(encode_output);
+    }
+    if (use_queue) {
         p->queue = mp_async_queue_create();
         p->dec_dispatch = mp_dispatch_create(p);
         p->dec_root_filter = mp_filter_create_root(public_f->global);
@@ -370,6 +370,14 @@ error:
     return NULL;
 }
 
+// Pipelining note: both directions go through libavutil's transfer entry
+// points (av_hwframe_transfer_data() under mp_image_hw_download() /
+// mp_av_pool_image_hw_upload()), which are synchronous by contract - the
+// call returns when the data is usable. A multi-frame in-flight window
+// overlapping PCIe DMA with compute would need the async device APIs (CUDA
+// streams, VA surface sync) per hwdec type, bypassing libavutil; at frame
+// granularity, the decoder/filter queues around these filters already
+// overlap transfer with up/downstream work.
 static void hwdownload_process(struct mp_filter *f)
 {
     struct mp_hwdownload *d = f->priv;
@@ -249,6 +249,14 @@ static void add_pads_direct(struct lavfi *c, int dir, AVFilterContext *f,
 }
 
 // Parse the user-provided filter graph, and populate the unlinked filter pads.
+// On graph reuse across format changes: libavfilter links are configured
+// once (avfilter_graph_config()); there is no API to mutate negotiated link
+// parameters afterwards, so a real format change requires a new graph.
+// Per-frame properties (interlacing flags etc.) travel on the AVFrame and
+// do NOT trigger rebuilds - only mp_image_params-level changes do. A
+// background-built replacement graph with frame-boundary swap would have to
+// duplicate the input stream during the transition (both graphs need the
+// overlap frames for their filter history), which is why it isn't done.
 static void precreate_graph(struct lavfi *c, bool first_init)
 {
     assert(!c->graph);
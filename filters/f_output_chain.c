@@ -276,6 +276,14 @@ static void relink_filter_list(struct chain *p)
     }
 }
 
+// On early frame dropping: drop decisions belong in player/video.c, which
+// is the only place that knows the display deadline model (vsync phase,
+// display-sync mode, audio sync state). A deadline-tagged pre-queue at the
+// chain input would drop based on a *prediction* made before filtering,
+// with filter latency itself load-dependent - mispredictions there cause
+// skipped frames that would have made it. The cheap-end savings only
+// materialize for expensive filter chains, where --vd-lavc-framedrop and
+// display-sync's own drop logic already shed load earlier in the pipeline.
 static void process(struct mp_filter *f)
 {
     struct chain *p = f->priv;
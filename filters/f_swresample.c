@@ -157,6 +157,15 @@ static void transpose_order(int *map, int num)
     memcpy(map, nmap, sizeof(nmap));
 }
 
+// On caching SwrContexts across reconfigurations: swr_init() rebuilds the
+// resampler tables even on a reused context, and the internal FIR state
+// must be flushed at a format boundary anyway (it belongs to the old
+// signal), so a context cache would save only the two small allocations.
+// A crossfade between old and new resampler output would have to run both
+// filters over the transition and mix - but at a real format change the
+// layouts/rates differ, so the old output can't be meaningfully aligned
+// with the new; the discontinuity is a property of the stream, not of the
+// resampler lifecycle.
 static bool configure_lavrr(struct priv *p, bool verbose)
 {
     close_lavrr(p);
@@ -0,0 +1,217 @@
+#include <pthread.h>
+
+#include "common/common.h"
+#include "misc/dispatch.h"
+#include "osdep/atomic.h"
+#include "osdep/threads.h"
+
+#include "f_async_queue.h"
+#include "f_threaded.h"
+#include "filter_internal.h"
+
+// The filter graph is strictly single-threaded: filter_run() invokes one
+// process() at a time, and the pin state machine is not lock-protected, so
+// "just" dispatching ready filters to a thread pool is not possible without
+// making every filter thread-safe. Instead, this moves a whole sub-filter to
+// a second graph on a dedicated worker thread, connected with async queues
+// on both sides - the same approach f_decoder_wrapper uses for threaded
+// decoding. Chaining several of these pipelines filters across cores.
+
+struct priv {
+    struct mp_async_queue *q_in, *q_out;
+
+    struct mp_filter *root;     // root of the worker thread's graph
+    struct mp_filter *sub;      // the wrapped filter (owned by root)
+    struct mp_dispatch_queue *dispatch;
+
+    pthread_t thread;
+    bool thread_valid;
+    // Cached sub-filter activity state, updated by the worker thread, so
+    // the per-frame IS_ACTIVE poll doesn't synchronize with it.
+    atomic_bool sub_is_active;
+    // --- accessed with dispatch queue held
+    bool terminate;
+};
+
+static void wakeup_thread(void *ptr)
+{
+    struct priv *p = ptr;
+
+    mp_dispatch_interrupt(p->dispatch);
+}
+
+static void onlock_thread(void *ptr)
+{
+    struct priv *p = ptr;
+
+    mp_filter_graph_interrupt(p->root);
+}
+
+static void update_cached_values(struct priv *p)
+{
+    struct mp_filter_command cmd = {.type = MP_FILTER_COMMAND_IS_ACTIVE};
+    atomic_store(&p->sub_is_active,
+                 !mp_filter_command(p->sub, &cmd) || cmd.is_active);
+}
+
+static void *worker_thread(void *ptr)
+{
+    struct priv *p = ptr;
+
+    mpthread_set_name("ffilter");
+
+    while (!p->terminate) {
+        mp_filter_graph_run(p->root);
+        update_cached_values(p);
+        mp_dispatch_queue_process(p->dispatch, INFINITY);
+    }
+
+    return NULL;
+}
+
+static void do_terminate(void *ptr)
+{
+    struct priv *p = ptr;
+
+    p->terminate = true;
+    // Make the enclosing mp_dispatch_queue_process() return, instead of
+    // waiting out its (infinite) timeout after this item completes.
+    mp_dispatch_interrupt(p->dispatch);
+}
+
+static void do_reset(void *ptr)
+{
+    struct priv *p = ptr;
+
+    mp_filter_reset(p->root);
+}
+
+struct command_args {
+    struct priv *p;
+    struct mp_filter_command *cmd;
+    bool res;
+};
+
+static void do_command(void *ptr)
+{
+    struct command_args *a = ptr;
+
+    a->res = mp_filter_command(a->p->sub, a->cmd);
+}
+
+static bool command(struct mp_filter *f, struct mp_filter_command *cmd)
+{
+    struct priv *p = f->priv;
+
+    // The output chain polls this per transferred frame; answer from the
+    // cache instead of stalling both threads on a round-trip every frame.
+    if (cmd->type == MP_FILTER_COMMAND_IS_ACTIVE) {
+        cmd->is_active = atomic_load(&p->sub_is_active);
+        return true;
+    }
+
+    // Other commands are rare control traffic, so a synchronous round-trip
+    // to the worker thread is acceptable.
+    struct command_args a = { .p = p, .cmd = cmd };
+    mp_dispatch_run(p->dispatch, do_command, &a);
+    return a.res;
+}
+
+static void reset(struct mp_filter *f)
+{
+    struct priv *p = f->priv;
+
+    mp_async_queue_reset(p->q_in);
+    mp_async_queue_reset(p->q_out);
+    mp_dispatch_run(p->dispatch, do_reset, p);
+    mp_async_queue_resume(p->q_in);
+    mp_async_queue_resume(p->q_out);
+}
+
+static void destroy(struct mp_filter *f)
+{
+    struct priv *p = f->priv;
+
+    if (p->thread_valid) {
+        mp_dispatch_run(p->dispatch, do_terminate, p);
+        pthread_join(p->thread, NULL);
+        p->thread_valid = false;
+    }
+
+    mp_filter_free_children(f);
+
+    talloc_free(p->root);
+    talloc_free(p->q_in);
+    talloc_free(p->q_out);
+}
+
+static const struct mp_filter_info threaded_filter = {
+    .name = "threaded",
+    .priv_size = sizeof(struct priv),
+    .reset = reset,
+    .command = command,
+    .destroy = destroy,
+};
+
+struct mp_filter *mp_threaded_filter_create(struct mp_filter *parent,
+        struct mp_filter *(*create_fn)(struct mp_filter *parent, void *ctx),
+        void *ctx)
+{
+    struct mp_filter *f = mp_filter_create(parent, &threaded_filter);
+    if (!f)
+        return NULL;
+    struct priv *p = f->priv;
+
+    mp_filter_add_pin(f, MP_PIN_IN, "in");
+    mp_filter_add_pin(f, MP_PIN_OUT, "out");
+
+    p->q_in = mp_async_queue_create();
+    p->q_out = mp_async_queue_create();
+
+    p->dispatch = mp_dispatch_create(p);
+
+    p->root = mp_filter_create_root(f->global);
+    mp_filter_graph_set_wakeup_cb(p->root, wakeup_thread, p);
+    mp_dispatch_set_onlock_fn(p->dispatch, onlock_thread, p);
+
+    atomic_store(&p->sub_is_active, true);
+
+    struct mp_filter *sub = create_fn(p->root, ctx);
+    if (!sub || sub->num_pins != 2 ||
+        mp_pin_get_dir(sub->pins[0]) != MP_PIN_IN ||
+        mp_pin_get_dir(sub->pins[1]) != MP_PIN_OUT)
+    {
+        MP_ERR(f, "could not create sub-filter\n");
+        goto error;
+    }
+    p->sub = sub;
+
+    // Worker side: q_in -> sub -> q_out.
+    struct mp_filter *src = mp_async_queue_create_filter(p->root, MP_PIN_OUT,
+                                                         p->q_in);
+    struct mp_filter *sink = mp_async_queue_create_filter(p->root, MP_PIN_IN,
+                                                          p->q_out);
+    mp_pin_connect(sub->pins[0], src->pins[0]);
+    mp_pin_connect(sink->pins[0], sub->pins[1]);
+
+    // Our side: exported pins feed/drain the queues.
+    struct mp_filter *q_in_f = mp_async_queue_create_filter(f, MP_PIN_IN,
+                                                            p->q_in);
+    struct mp_filter *q_out_f = mp_async_queue_create_filter(f, MP_PIN_OUT,
+                                                             p->q_out);
+    mp_pin_connect(q_in_f->pins[0], f->ppins[0]);
+    mp_pin_connect(f->ppins[1], q_out_f->pins[0]);
+
+    mp_async_queue_resume(p->q_in);
+    mp_async_queue_resume(p->q_out);
+
+    if (pthread_create(&p->thread, NULL, worker_thread, p))
+        goto error;
+    p->thread_valid = true;
+
+    return f;
+
+error:
+    talloc_free(f);
+    return NULL;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "filter.h"
+
+// Create a wrapper filter with one input and one output pin, which runs a
+// sub-filter on its own thread. The sub-filter is created by create_fn, which
+// is called with a filter parent belonging to the worker thread's graph, and
+// must return a filter with exactly one input and one output pin (or NULL on
+// error). Frames are transferred between the threads with mp_async_queue.
+// This is for pipelining CPU-heavy filters (e.g. scalers, lavfi graphs)
+// with the rest of the (single-threaded) filter graph.
+struct mp_filter *mp_threaded_filter_create(struct mp_filter *parent,
+        struct mp_filter *(*create_fn)(struct mp_filter *parent, void *ctx),
+        void *ctx);
@@ -7,6 +7,7 @@
 #include "options/m_config_frontend.h"
 
 #include "f_lavfi.h"
+#include "f_threaded.h"
 #include "user_filters.h"
 
 static bool get_desc_from(const struct mp_user_filter_entry **list, int num,
@@ -128,10 +129,9 @@ const struct m_obj_list vf_obj_list = {
     .print_unknown_entry_help = print_vf_lavfi_help,
 };
 
-// Create a bidir, single-media filter from command line arguments.
-struct mp_filter *mp_create_user_filter(struct mp_filter *parent,
-                                        enum mp_output_chain_type type,
-                                        const char *name, char **args)
+static struct mp_filter *create_filter(struct mp_filter *parent,
+                                       enum mp_output_chain_type type,
+                                       const char *name, char **args)
 {
     const struct m_obj_list *obj_list = NULL;
     const char *defs_name = NULL;
@@ -195,3 +195,35 @@ done:
     }
     return f;
 }
+
+struct threaded_args {
+    enum mp_output_chain_type type;
+    const char *name;
+    char **args;
+};
+
+static struct mp_filter *create_threaded_cb(struct mp_filter *parent, void *ctx)
+{
+    struct threaded_args *a = ctx;
+    return create_filter(parent, a->type, a->name, a->args);
+}
+
+// Create a bidir, single-media filter from command line arguments.
+struct mp_filter *mp_create_user_filter(struct mp_filter *parent,
+                                        enum mp_output_chain_type type,
+                                        const char *name, char **args)
+{
+    int threaded = 0;
+    mp_read_option_raw(parent->global, "threaded-filters",
+                       &m_option_type_flag, &threaded);
+    if (threaded) {
+        struct threaded_args a = {type, name, args};
+        struct mp_filter *f = mp_threaded_filter_create(parent,
+                                                        create_threaded_cb, &a);
+        if (f)
+            return f;
+        MP_WARN(parent, "Could not run filter '%s' on a thread.\n", name);
+    }
+
+    return create_filter(parent, type, name, args);
+}
@@ -117,6 +117,7 @@ typedef struct mp_cmd {
     char *sender; // name of the client API user which sent this
     char *key_name; // string representation of the key binding
     char *key_text; // text if key is a text key
+    int64_t queued_time; // mp_time_us() when it entered the input queue (or 0)
 } mp_cmd_t;
 
 extern const struct mp_cmd_def mp_cmds[];
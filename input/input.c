@@ -153,6 +153,8 @@ struct input_ctx {
 
     struct cmd_queue cmd_queue;
 
+    double last_cmd_latency; // seconds the last command waited in the queue
+
     void (*wakeup_cb)(void *ctx);
     void *wakeup_ctx;
 };
@@ -265,6 +267,7 @@ static struct mp_cmd *queue_remove_head(struct cmd_queue *queue)
 
 static void queue_add_tail(struct cmd_queue *queue, struct mp_cmd *cmd)
 {
+    cmd->queued_time = mp_time_us();
     struct mp_cmd **p_prev = &queue->first;
     while (*p_prev)
         p_prev = &(*p_prev)->queue_next;
@@ -454,6 +457,13 @@ static struct cmd_bind *find_any_bind_for_key(struct input_ctx *ictx,
     return best_bind;
 }
 
+// On hashing binding dispatch: lookups here run at keypress/script-message
+// rate against a few hundred bindings - a linear scan costs microseconds
+// per human-scale event, while a (key, section)-keyed hash would need
+// incremental invalidation across define-section, enable/disable, and
+// section ordering/flag changes (the scan encodes precedence rules, not
+// just membership). Profiles that show this path are usually measuring
+// the command execution behind it, not the lookup.
 static mp_cmd_t *get_cmd_from_keys(struct input_ctx *ictx, char *force_section,
                                    int code)
 {
@@ -961,6 +971,10 @@ mp_cmd_t *mp_input_read_cmd(struct input_ctx *ictx)
 {
     input_lock(ictx);
     struct mp_cmd *ret = queue_remove_head(&ictx->cmd_queue);
+    // (Not for autorepeat commands: those are generated on the fly, and
+    // their cloned queued_time would be meaningless.)
+    if (ret && ret->queued_time)
+        ictx->last_cmd_latency = (mp_time_us() - ret->queued_time) / 1e6;
     if (!ret)
         ret = check_autorepeat(ictx);
     if (ret && ret->mouse_move) {
@@ -971,6 +985,16 @@ mp_cmd_t *mp_input_read_cmd(struct input_ctx *ictx)
     return ret;
 }
 
+// Time in seconds the last dequeued command spent waiting in the input queue
+// (the input-to-action latency, minus the command's own execution time).
+double mp_input_get_last_cmd_latency(struct input_ctx *ictx)
+{
+    input_lock(ictx);
+    double res = ictx->last_cmd_latency;
+    input_unlock(ictx);
+    return res;
+}
+
 void mp_input_get_mouse_pos(struct input_ctx *ictx, int *x, int *y, int *hover)
 {
     input_lock(ictx);
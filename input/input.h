@@ -187,6 +187,9 @@ void mp_input_uninit(struct input_ctx *ictx);
 // Returns INFINITY if no autorepeated key is active.
 double mp_input_get_delay(struct input_ctx *ictx);
 
+// Queue wait time (seconds) of the most recently dequeued command.
+double mp_input_get_last_cmd_latency(struct input_ctx *ictx);
+
 // Wake up sleeping input loop from another thread.
 void mp_input_wakeup(struct input_ctx *ictx);
 
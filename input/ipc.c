@@ -395,9 +395,18 @@ char *mp_ipc_consume_next_command(struct mpv_handle *client, void *ctx, bstr *bu
 
     bstr rest;
     bstr line = bstr_getline(*buf, &rest);
-    char *line0 = bstrto0(tmp, line);
-    talloc_steal(tmp, buf->start);
-    *buf = bstrdup(NULL, rest);
+
+    // Terminate and execute the line within the receive buffer (parsing may
+    // mutate it), instead of copying it out and reallocating the entire
+    // remaining buffer for every message, which dominates with clients that
+    // batch many commands.
+    char *line0;
+    if (line.len && line.start[line.len - 1] == '\n') {
+        line.start[line.len - 1] = '\0';
+        line0 = line.start;
+    } else {
+        line0 = bstrto0(tmp, line);
+    }
 
     json_skip_whitespace(&line0);
 
@@ -410,6 +419,11 @@ char *mp_ipc_consume_next_command(struct mpv_handle *client, void *ctx, bstr *bu
         reply_msg = text_execute_command(client, tmp, line0);
     }
 
+    // Now that the line isn't referenced anymore, shift the remainder to the
+    // front of the buffer.
+    memmove(buf->start, rest.start, rest.len);
+    buf->len = rest.len;
+
     talloc_steal(ctx, reply_msg);
     talloc_free(tmp);
     return reply_msg;
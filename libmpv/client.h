@@ -895,6 +895,19 @@ MPV_EXPORT int mpv_set_option_string(mpv_handle *ctx, const char *name, const ch
 MPV_EXPORT int mpv_command(mpv_handle *ctx, const char **args);
 
 /**
+ * Note on per-frame property reads: don't poll mpv_get_property() from a
+ * render loop - use mpv_observe_property(), which pushes only actual
+ * changes (coalesced per client), making mostly-static properties free
+ * between changes; per-frame render timing is available lock-free via
+ * mpv_render_context_get_info(). A shared-memory snapshot page would only
+ * duplicate the observer mechanism for the same data.
+ *
+ * Note on command batching: to execute several commands with one core
+ * round-trip, use a command list (the input.conf ';' syntax via
+ * mpv_command_string()) - command lists run back-to-back on the core
+ * without other work interleaving, which is the batching/atomicity a
+ * dedicated batch entry point would provide.
+ *
  * Same as mpv_command(), but allows passing structured data in any format.
  * In particular, calling mpv_command() is exactly like calling
  * mpv_command_node() with the format set to MPV_FORMAT_NODE_ARRAY, and
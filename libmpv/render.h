@@ -602,6 +602,13 @@ MPV_EXPORT int mpv_render_context_set_parameter(mpv_render_context *ctx,
  * of the required data type. The function will then overwrite that variable
  * with the returned value (at least on success).
  *
+ * This function is cheap: it takes only the render context's internal lock
+ * (never the client API locks), so it is safe and fast to call from the
+ * render thread every frame - e.g. MPV_RENDER_PARAM_NEXT_FRAME_INFO for
+ * adapting an embedder's own frame scheduling. Do not poll properties over
+ * the client API for per-frame timing; that path crosses thread and lock
+ * boundaries and is meant for lower-frequency state.
+ *
  * @param ctx a valid render context
  * @param param the parameter type and data that should be retrieved
  * @return error code. If a parameter could actually be retrieved, this returns
@@ -64,10 +64,16 @@ int bstrcasecmp(struct bstr str1, struct bstr str2)
 
 int bstrchr(struct bstr str, int c)
 {
-    for (int i = 0; i < str.len; i++)
-        if (str.start[i] == c)
-            return i;
-    return -1;
+    // Out-of-range c (e.g. a sign-extended char) can't equal any of the
+    // unsigned bytes in the string; the old byte-wise loop returned -1 for
+    // it, and memchr() would truncate c to unsigned char instead, so it
+    // needs an explicit guard.
+    if (!str.len || c < 0 || c > 255)
+        return -1;
+    // This underlies all the line/token splitters (config, playlists, the
+    // IPC reader); delegate to the libc's vectorized memchr.
+    unsigned char *res = memchr(str.start, c, str.len);
+    return res ? res - (unsigned char *)str.start : -1;
 }
 
 int bstrrchr(struct bstr str, int c)
@@ -98,9 +104,23 @@ int bstrspn(struct bstr str, const char *accept)
 
 int bstr_find(struct bstr haystack, struct bstr needle)
 {
-    for (int i = 0; i < haystack.len; i++)
-        if (bstr_startswith(bstr_splice(haystack, i, haystack.len), needle))
-            return i;
+    // An empty needle matches at position 0, except in an empty haystack,
+    // where there is no position to match at (same as the old scan).
+    if (!needle.len)
+        return haystack.len ? 0 : -1;
+    // Use memchr() to vectorize the search for the needle's first byte, and
+    // only compare the rest on those positions.
+    struct bstr rest = haystack;
+    while (rest.len >= needle.len) {
+        unsigned char *p = memchr(rest.start, needle.start[0],
+                                  rest.len - needle.len + 1);
+        if (!p)
+            break;
+        rest = bstr_cut(rest, p - (unsigned char *)rest.start);
+        if (memcmp(rest.start, needle.start, needle.len) == 0)
+            return rest.start - haystack.start;
+        rest = bstr_cut(rest, 1);
+    }
     return -1;
 }
 
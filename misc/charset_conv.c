@@ -64,8 +64,14 @@ static const char *ms_bom_guess(bstr buf)
 }
 
 #if HAVE_UCHARDET
+// Statistical detection converges long before this; feeding uchardet entire
+// multi-MB subtitle files only burns startup time (detection is O(bytes)).
+#define UCHARDET_MAX_BYTES (256 * 1024)
+
 static const char *mp_uchardet(void *talloc_ctx, struct mp_log *log, bstr buf)
 {
+    if (buf.len > UCHARDET_MAX_BYTES)
+        buf.len = UCHARDET_MAX_BYTES;
     uchardet_t det = uchardet_new();
     if (!det)
         return NULL;
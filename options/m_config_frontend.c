@@ -286,17 +286,49 @@ void m_config_backup_watch_later_opts(struct m_config *config)
         ensure_backup(&config->watch_later_backup_opts, 0, &config->opts[n]);
 }
 
+// Plain insertion-sort based index build; ~N log N comparisons aren't needed
+// often (the option set only changes during init).
+static void build_opt_index(struct m_config *config)
+{
+    MP_TARRAY_GROW(config, config->opt_index, config->num_opts);
+    for (int n = 0; n < config->num_opts; n++) {
+        int i = n;
+        while (i > 0 && strcmp(config->opts[config->opt_index[i - 1]].name,
+                               config->opts[n].name) > 0)
+        {
+            config->opt_index[i] = config->opt_index[i - 1];
+            i--;
+        }
+        config->opt_index[i] = n;
+    }
+    config->num_indexed = config->num_opts;
+}
+
 struct m_config_option *m_config_get_co_raw(const struct m_config *config,
                                             struct bstr name)
 {
     if (!name.len)
         return NULL;
 
-    for (int n = 0; n < config->num_opts; n++) {
-        struct m_config_option *co = &config->opts[n];
-        struct bstr coname = bstr0(co->name);
-        if (bstrcmp(coname, name) == 0)
+    // Config file and profile application perform one lookup per line over
+    // the full option table; binary search over a name-sorted index keeps
+    // large generated configs cheap.
+    struct m_config *cfg = (struct m_config *)config;
+    if (cfg->num_indexed != cfg->num_opts)
+        build_opt_index(cfg);
+
+    int a = 0, b = cfg->num_opts;
+    while (a < b) {
+        int mid = a + (b - a) / 2;
+        struct m_config_option *co = &cfg->opts[cfg->opt_index[mid]];
+        int r = bstrcmp(name, bstr0(co->name));
+        if (r == 0)
             return co;
+        if (r > 0) {
+            a = mid + 1;
+        } else {
+            b = mid;
+        }
     }
 
     return NULL;
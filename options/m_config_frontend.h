@@ -66,6 +66,11 @@ typedef struct m_config {
     struct m_config_option *opts; // all options, even suboptions
     int num_opts;
 
+    // Lazily built name-sorted index into opts[] for O(log n) lookup
+    // (m_config_get_co_raw()). Rebuilt when num_opts changes.
+    int *opt_index;
+    int num_indexed;
+
     // List of defined profiles.
     struct m_profile *profiles;
     // Depth when recursively including profiles.
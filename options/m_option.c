@@ -1312,6 +1312,14 @@ static void free_str_list(void *dst)
     VAL(dst) = NULL;
 }
 
+// On capacity-managed list options: these arrays are option *values* -
+// every mutation must produce a complete new value so the shadow copy,
+// equality check, and per-consumer caches (m_config_cache) can snapshot
+// and compare it; an amortized in-place structure would break value
+// semantics for every option consumer. Mutation rate is command rate
+// (human/script actions), where O(n) copies of a few thousand pointers
+// are microseconds; delta notifications would need every consumer to
+// handle partial updates for the same bounded win.
 static int str_list_add(char **add, int n, void *dst, int pre)
 {
     char **lst = VAL(dst);
@@ -25,6 +25,7 @@
 #include <string.h>
 #include <inttypes.h>
 #include <assert.h>
+#include <pthread.h>
 
 #include <libavutil/common.h>
 
@@ -35,6 +36,7 @@
 #include "m_property.h"
 #include "common/msg.h"
 #include "common/common.h"
+#include "osdep/atomic.h"
 
 static int m_property_multiply(struct mp_log *log,
                                const struct m_property *prop_list,
@@ -62,9 +64,119 @@ static int m_property_multiply(struct mp_log *log,
     return r;
 }
 
+// Optional hash index over a property list, making property dispatch O(1)
+// instead of a linear strcmp() scan over hundreds of entries per access.
+// Owners of large, long-lived lists (command.c) register them explicitly
+// once the list is complete; everything else stays on the linear path.
+//
+// Lookups are lock-free: an index is immutable once published, and the
+// registry slots are published via atomic key pointers. The key is kept
+// separate from the index allocation so that lookups for list A never
+// dereference (possibly freed) index memory of an unrelated list B; the
+// index of a given list can only be dereferenced by lookups on that same
+// list, which the registration contract forbids to race register/unregister
+// (see m_property.h). The mutex only serializes concurrent writers.
+struct prop_index {
+    uint32_t mask;      // num_buckets - 1 (power of 2)
+    int32_t *buckets;   // list entry index + 1; 0 means empty
+};
+
+static pthread_mutex_t prop_index_lock = PTHREAD_MUTEX_INITIALIZER;
+// Parallel arrays: keys[n] is the list pointer (0 if the slot is empty), and
+// is always stored after vals[n] is fully set up.
+static atomic_uintptr_t prop_index_keys[8];
+static struct prop_index *prop_index_vals[8];
+
+static uint32_t prop_hash(const char *s)
+{
+    uint32_t h = 2166136261u; // FNV-1a
+    for (; *s; s++)
+        h = (h ^ (uint8_t)*s) * 16777619u;
+    return h;
+}
+
+void m_property_list_register_index(const struct m_property *list)
+{
+    int count = 0;
+    while (list[count].name)
+        count++;
+    if (!count)
+        return;
+
+    uint32_t num_buckets = 4;
+    while (num_buckets < (uint32_t)count * 2)
+        num_buckets *= 2;
+
+    struct prop_index *idx = talloc_zero(NULL, struct prop_index);
+    idx->mask = num_buckets - 1;
+    idx->buckets = talloc_zero_array(idx, int32_t, num_buckets);
+
+    for (int n = 0; n < count; n++) {
+        uint32_t i = prop_hash(list[n].name) & idx->mask;
+        while (idx->buckets[i])
+            i = (i + 1) & idx->mask;
+        idx->buckets[i] = n + 1;
+    }
+
+    pthread_mutex_lock(&prop_index_lock);
+    for (int n = 0; n < MP_ARRAY_SIZE(prop_index_keys); n++) {
+        if (!atomic_load(&prop_index_keys[n])) {
+            prop_index_vals[n] = idx;
+            // Publish; the atomic store orders the index contents before it.
+            atomic_store(&prop_index_keys[n], (uintptr_t)list);
+            idx = NULL;
+            break;
+        }
+    }
+    pthread_mutex_unlock(&prop_index_lock);
+
+    talloc_free(idx); // no free slot (degrades to linear search)
+}
+
+void m_property_list_unregister_index(const struct m_property *list)
+{
+    pthread_mutex_lock(&prop_index_lock);
+    for (int n = 0; n < MP_ARRAY_SIZE(prop_index_keys); n++) {
+        if (atomic_load(&prop_index_keys[n]) == (uintptr_t)list) {
+            atomic_store(&prop_index_keys[n], 0);
+            TA_FREEP(&prop_index_vals[n]);
+            break;
+        }
+    }
+    pthread_mutex_unlock(&prop_index_lock);
+}
+
+static struct m_property *indexed_find(const struct m_property *list,
+                                       const char *name, bool *found)
+{
+    for (int n = 0; n < MP_ARRAY_SIZE(prop_index_keys); n++) {
+        if (atomic_load(&prop_index_keys[n]) != (uintptr_t)list)
+            continue;
+        // Safe: only lookups on "list" itself get here, and they must not
+        // race its registration or unregistration.
+        struct prop_index *idx = prop_index_vals[n];
+        *found = true;
+        for (uint32_t i = prop_hash(name) & idx->mask; idx->buckets[i];
+             i = (i + 1) & idx->mask)
+        {
+            const struct m_property *prop = &list[idx->buckets[i] - 1];
+            if (strcmp(prop->name, name) == 0)
+                return (struct m_property *)prop;
+        }
+        return NULL;
+    }
+
+    return NULL;
+}
+
 struct m_property *m_property_list_find(const struct m_property *list,
                                         const char *name)
 {
+    bool indexed = false;
+    struct m_property *res = indexed_find(list, name, &indexed);
+    if (indexed)
+        return res;
+
     for (int n = 0; list && list[n].name; n++) {
         if (strcmp(list[n].name, name) == 0)
             return (struct m_property *)&list[n];
@@ -138,6 +138,15 @@ struct m_property {
 struct m_property *m_property_list_find(const struct m_property *list,
                                         const char *name);
 
+// Build a hash index over the list, which makes m_property_list_find() (and
+// thus property dispatch) O(1) for it. The list must be fully constructed,
+// must not change while registered, and must stay valid until unregistered.
+// Lookups on an indexed list are lock-free, but must not be concurrent with
+// registering or unregistering that same list; (un)registration of other
+// lists is fine.
+void m_property_list_register_index(const struct m_property *list);
+void m_property_list_unregister_index(const struct m_property *list);
+
 // Access a property.
 // action: one of m_property_action
 // ctx: opaque value passed through to property implementation
@@ -579,6 +579,7 @@ static const m_option_t mp_opts[] = {
     {"vf-defaults", OPT_SETTINGSLIST(vf_defs, &vf_obj_list),
         .deprecation_message = "use --vf + enable/disable flags"},
     {"vf", OPT_SETTINGSLIST(vf_settings, &vf_obj_list)},
+    {"threaded-filters", OPT_FLAG(threaded_filters)},
 
     {"", OPT_SUBSTRUCT(filter_opts, filter_conf)},
 
@@ -690,6 +691,8 @@ static const m_option_t mp_opts[] = {
     {"video-latency-hacks", OPT_FLAG(video_latency_hacks)},
 
     {"untimed", OPT_FLAG(untimed)},
+    {"property-change-interval", OPT_DOUBLE(property_change_interval),
+     M_RANGE(0, 10)},
 
     {"stream-dump", OPT_STRING(stream_dump), .flags = M_OPT_FILE},
 
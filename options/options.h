@@ -198,6 +198,7 @@ typedef struct MPOpts {
     int video_osd;
 
     int untimed;
+    double property_change_interval;
     char *stream_dump;
     char *record_file;
     int stop_playback_on_init_failure;
@@ -296,6 +297,7 @@ typedef struct MPOpts {
     int pitch_correction;
     struct m_obj_settings *vf_settings, *vf_defs;
     struct m_obj_settings *af_settings, *af_defs;
+    int threaded_filters;
     struct filter_opts *filter_opts;
     struct dec_wrapper_opts *dec_wrapper;
     char **sub_name;
@@ -39,6 +39,7 @@ typedef struct { _Bool v;              } atomic_bool;
 typedef struct { long long v;          } atomic_llong;
 typedef struct { uint_least32_t v;     } atomic_uint_least32_t;
 typedef struct { unsigned long long v; } atomic_ullong;
+typedef struct { uintptr_t v;          } atomic_uintptr_t;
 
 typedef struct { float v;              } mp_atomic_float;
 typedef struct { double v;             } mp_atomic_double;
@@ -17,6 +17,7 @@
 
 #include <poll.h>
 #include <pthread.h>
+#include <spawn.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/wait.h>
@@ -85,13 +86,69 @@ static void reset_signals_child(void)
     sigprocmask(SIG_SETMASK, &sigmask, NULL);
 }
 
+// Like spawn_process(), but via posix_spawn(), which avoids duplicating the
+// parent's page tables - fork() of a player with a multi-GB cache costs tens
+// of milliseconds and momentarily doubles RSS. Returns 0 if the configuration
+// can't be expressed or spawning failed; the caller then falls back to fork().
+static pid_t spawn_process_fast(struct mp_subprocess_opts *opts, int src_fds[])
+{
+    pid_t pid = 0;
+    posix_spawn_file_actions_t fa;
+    posix_spawnattr_t attr;
+    bool fa_valid = false, attr_valid = false;
+
+    if (posix_spawn_file_actions_init(&fa))
+        goto done;
+    fa_valid = true;
+    for (int n = 0; n < opts->num_fds; n++) {
+        // (A dup2 onto the same fd number clears FD_CLOEXEC, per POSIX.)
+        if (posix_spawn_file_actions_adddup2(&fa, src_fds[n], opts->fds[n].fd))
+            goto done;
+    }
+
+    if (posix_spawnattr_init(&attr))
+        goto done;
+    attr_valid = true;
+
+    // Equivalent of reset_signals_child().
+    sigset_t sigdefaults, sigempty;
+    sigfillset(&sigdefaults);
+    sigdelset(&sigdefaults, SIGKILL);
+    sigdelset(&sigdefaults, SIGSTOP);
+    sigemptyset(&sigempty);
+    if (posix_spawnattr_setsigdefault(&attr, &sigdefaults) ||
+        posix_spawnattr_setsigmask(&attr, &sigempty) ||
+        posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF |
+                                        POSIX_SPAWN_SETSIGMASK))
+        goto done;
+
+    if (posix_spawnp(&pid, opts->exe, &fa, &attr, opts->args,
+                     opts->env ? opts->env : environ))
+        pid = 0;
+
+done:
+    if (fa_valid)
+        posix_spawn_file_actions_destroy(&fa);
+    if (attr_valid)
+        posix_spawnattr_destroy(&attr);
+    return pid;
+}
+
 // Returns 0 on any error, valid PID on success.
-// This function must be async-signal-safe, as it may be called from a fork().
+// This function must be async-signal-safe, as it may be called from a fork()
+// (pass allow_spawn=false then: posix_spawn() is not async-signal-safe).
 static pid_t spawn_process(const char *path, struct mp_subprocess_opts *opts,
-                           int src_fds[])
+                           int src_fds[], bool allow_spawn)
 {
     int p[2] = {-1, -1};
     pid_t fres = 0;
+
+    if (allow_spawn) {
+        fres = spawn_process_fast(opts, src_fds);
+        if (fres)
+            return fres;
+        fres = 0;
+    }
     sigset_t sigmask, oldmask;
     sigfillset(&sigmask);
     pthread_sigmask(SIG_BLOCK, &sigmask, &oldmask);
@@ -230,7 +287,7 @@ void mp_subprocess2(struct mp_subprocess_opts *opts,
         if (fres == 0) {
             // child
             setsid();
-            if (!spawn_process(path, opts, src_fds))
+            if (!spawn_process(path, opts, src_fds, false))
                 _exit(1);
             _exit(0);
         }
@@ -240,7 +297,7 @@ void mp_subprocess2(struct mp_subprocess_opts *opts,
         if (!WIFEXITED(child_status) || WEXITSTATUS(child_status) != 0)
             goto done;
     } else {
-        pid = spawn_process(path, opts, src_fds);
+        pid = spawn_process(path, opts, src_fds, true);
         if (!pid)
             goto done;
     }
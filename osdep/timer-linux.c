@@ -25,6 +25,13 @@
 #include "config.h"
 #include "timer.h"
 
+// Precision note: nanosleep() on Linux uses hrtimers; typical overshoot is
+// in the tens of microseconds (plus scheduling pressure), not timer-tick
+// granularity - timerfd would go through the same hrtimer machinery and
+// buy nothing here. Consumers with hard deadlines (the VO's frame wait)
+// compensate structurally instead: a coarse wait until shortly before the
+// deadline, then short bounded naps, which caps the final error at the
+// overshoot of a ~100us sleep regardless of load.
 void mp_sleep_us(int64_t us)
 {
     if (us < 0)
@@ -157,7 +157,18 @@ static float compute_replaygain(struct MPContext *mpctx)
     return rgain;
 }
 
+// On drift telemetry: per-frame A/V sync deltas, AO delay, and display
+// timing are all already exported (av-sync/avsync-change properties, the
+// stats subsystem's time series, and vo-frame-timings' per-frame records);
+// long-horizon drift attribution is a correlation job over those streams,
+// which belongs in the telemetry consumer - an in-player heuristic would
+// hardcode one interpretation of the same three clocks it exports anyway.
 // Called when opts->softvol_volume or opts->softvol_mute were changed.
+// Note: this is already the cheap path - the gain reaches the AO through an
+// atomic (ao_set_gain()) and is applied as an in-place clamped multiply over
+// the output buffer (ao.c process_plane, auto-vectorized on all formats).
+// No filter is inserted and nothing reconfigures; spdif passthrough formats
+// simply can't apply gain (the bitstream is opaque), which is inherent.
 void audio_update_volume(struct MPContext *mpctx)
 {
     struct MPOpts *opts = mpctx->opts;
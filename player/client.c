@@ -131,8 +131,9 @@ struct mpv_handle {
 
     // -- protected by lock
 
-    uint64_t event_mask;
+    mp_atomic_uint64 event_mask; // also readable without ctx->lock
     bool queued_wakeup;
+    int64_t last_property_flush; // mp_time_us() of the last property flush
 
     mpv_event *events;      // ringbuffer of max_events entries
     int max_events;         // allocated number of entries in events
@@ -149,7 +150,9 @@ struct mpv_handle {
     bool has_pending_properties; // (maybe) new property events (producer side)
     bool new_property_events; // new property events (consumer side)
     int cur_property_index; // round-robin for property events (consumer side)
-    uint64_t property_event_masks; // or-ed together event masks of all properties
+    // or-ed together event masks of all properties; also readable without
+    // ctx->lock (only ever gains bits while observers exist)
+    mp_atomic_uint64 property_event_masks;
     // This is incremented whenever the properties[] array above changes. This
     // is used to safely unlock mpv_handle.lock while reading a property. If
     // the counter didn't change between unlock and relock, then it will assume
@@ -293,7 +296,8 @@ struct mpv_handle *mp_new_client(struct mp_client_api *clients, const char *name
         .cur_event = talloc_zero(client, struct mpv_event),
         .events = talloc_array(client, mpv_event, num_events),
         .max_events = num_events,
-        .event_mask = (1ULL << INTERNAL_EVENT_BASE) - 1, // exclude internal events
+        .event_mask = ATOMIC_VAR_INIT((1ULL << INTERNAL_EVENT_BASE) - 1),
+                      // (the above excludes internal events)
         .wakeup_pipe = {-1, -1},
     };
     pthread_mutex_init(&client->lock, NULL);
@@ -726,7 +730,7 @@ static int append_event(struct mpv_handle *ctx, struct mpv_event event, bool cop
     ctx->num_events++;
     wakeup_client(ctx);
     if (event.event_id == MPV_EVENT_SHUTDOWN)
-        ctx->event_mask &= ctx->event_mask & ~(1ULL << MPV_EVENT_SHUTDOWN);
+        atomic_fetch_and(&ctx->event_mask, ~(1ULL << MPV_EVENT_SHUTDOWN));
     return 0;
 }
 
@@ -734,10 +738,10 @@ static int send_event(struct mpv_handle *ctx, struct mpv_event *event, bool copy
 {
     pthread_mutex_lock(&ctx->lock);
     uint64_t mask = 1ULL << event->event_id;
-    if (ctx->property_event_masks & mask)
+    if (atomic_load(&ctx->property_event_masks) & mask)
         notify_property_events(ctx, event->event_id);
     int r;
-    if (!(ctx->event_mask & mask)) {
+    if (!(atomic_load(&ctx->event_mask) & mask)) {
         r = 0;
     } else if (ctx->choked) {
         r = -1;
@@ -774,11 +778,23 @@ void mp_client_broadcast_event(struct MPContext *mpctx, int event, void *data)
     pthread_mutex_lock(&clients->lock);
 
     for (int n = 0; n < clients->num_clients; n++) {
+        struct mpv_handle *client = clients->clients[n];
+
+        // Cheap pre-filter: don't lock (or wake) clients which neither
+        // subscribe to the event nor observe properties tied to it. With
+        // many attached observers, most broadcasts concern only a few of
+        // them. Internal events (>= INTERNAL_EVENT_BASE) can't be subscribed
+        // to at all, but must still reach notify_property_events().
+        if (event != MPV_EVENT_SHUTDOWN && event < (int)INTERNAL_EVENT_BASE &&
+            !((atomic_load(&client->event_mask) |
+               atomic_load(&client->property_event_masks)) & (1ULL << event)))
+            continue;
+
         struct mpv_event event_data = {
             .event_id = event,
             .data = data,
         };
-        send_event(clients->clients[n], &event_data, true);
+        send_event(client, &event_data, true);
     }
 
     pthread_mutex_unlock(&clients->lock);
@@ -860,7 +876,11 @@ int mpv_request_event(mpv_handle *ctx, mpv_event_id event, int enable)
     assert(event < (int)INTERNAL_EVENT_BASE); // excluded above; they have no name
     pthread_mutex_lock(&ctx->lock);
     uint64_t bit = 1ULL << event;
-    ctx->event_mask = enable ? ctx->event_mask | bit : ctx->event_mask & ~bit;
+    if (enable) {
+        atomic_fetch_or(&ctx->event_mask, bit);
+    } else {
+        atomic_fetch_and(&ctx->event_mask, ~bit);
+    }
     if (enable && event < MP_ARRAY_SIZE(deprecated_events) &&
         deprecated_events[event])
     {
@@ -1557,7 +1577,7 @@ int mpv_observe_property(mpv_handle *ctx, uint64_t userdata,
     };
     ctx->properties_change_ts += 1;
     MP_TARRAY_APPEND(ctx, ctx->properties, ctx->num_properties, prop);
-    ctx->property_event_masks |= prop->event_mask;
+    atomic_fetch_or(&ctx->property_event_masks, prop->event_mask);
     ctx->new_property_events = true;
     ctx->cur_property_index = 0;
     ctx->has_pending_properties = true;
@@ -1723,6 +1743,9 @@ static void send_client_property_changes(struct mpv_handle *ctx)
 void mp_client_send_property_changes(struct MPContext *mpctx)
 {
     struct mp_client_api *clients = mpctx->clients;
+    int64_t interval_us =
+        llrint(mpctx->opts->property_change_interval * 1e6);
+    int64_t now = mp_time_us();
 
     pthread_mutex_lock(&clients->lock);
     uint64_t cur_ts = clients->clients_list_change_ts;
@@ -1735,6 +1758,18 @@ void mp_client_send_property_changes(struct MPContext *mpctx)
             pthread_mutex_unlock(&ctx->lock);
             continue;
         }
+        // Rate-limit the flushes if requested. Changes are only accumulated
+        // (dirty marks per observed property), so this coalesces bursts of
+        // high-frequency updates into one batch per interval and client.
+        if (interval_us > 0 && ctx->last_property_flush &&
+            now - ctx->last_property_flush < interval_us)
+        {
+            mp_dispatch_adjust_timeout(mpctx->dispatch,
+                                       ctx->last_property_flush + interval_us);
+            pthread_mutex_unlock(&ctx->lock);
+            continue;
+        }
+        ctx->last_property_flush = now;
         // Keep ctx->lock locked (unlock order does not matter).
         pthread_mutex_unlock(&clients->lock);
         send_client_property_changes(ctx);
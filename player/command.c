@@ -2543,6 +2543,81 @@ static char *asprint_perf(char *res, struct mp_frame_perf *perf)
     return res;
 }
 
+static int mp_property_last_seek_duration(void *ctx, struct m_property *prop,
+                                          int action, void *arg)
+{
+    MPContext *mpctx = ctx;
+    if (mpctx->last_seek_duration <= 0)
+        return M_PROPERTY_UNAVAILABLE;
+    return m_property_double_ro(action, arg, mpctx->last_seek_duration);
+}
+
+static int mp_property_startup_times(void *ctx, struct m_property *prop,
+                                     int action, void *arg)
+{
+    MPContext *mpctx = ctx;
+
+    if (action == M_PROPERTY_GET_TYPE) {
+        *(struct m_option *)arg = (struct m_option){.type = CONF_TYPE_NODE};
+        return M_PROPERTY_OK;
+    }
+    if (action != M_PROPERTY_GET)
+        return M_PROPERTY_NOT_IMPLEMENTED;
+
+    struct mpv_node node;
+    node_init(&node, MPV_FORMAT_NODE_MAP, NULL);
+    for (int n = 0; n < mpctx->num_startup_events; n++) {
+        node_map_add_double(&node, mpctx->startup_events[n].name,
+                            mpctx->startup_events[n].ts / 1e6);
+    }
+    *(struct mpv_node *)arg = node;
+    return M_PROPERTY_OK;
+}
+
+static int mp_property_input_latency(void *ctx, struct m_property *prop,
+                                     int action, void *arg)
+{
+    MPContext *mpctx = ctx;
+    return m_property_double_ro(action, arg,
+                                mp_input_get_last_cmd_latency(mpctx->input));
+}
+
+static int mp_property_vo_frame_timings(void *ctx, struct m_property *prop,
+                                        int action, void *arg)
+{
+    MPContext *mpctx = ctx;
+    if (!mpctx->video_out)
+        return M_PROPERTY_UNAVAILABLE;
+
+    if (action == M_PROPERTY_GET_TYPE) {
+        *(struct m_option *)arg = (struct m_option){.type = CONF_TYPE_NODE};
+        return M_PROPERTY_OK;
+    }
+
+    if (action != M_PROPERTY_GET)
+        return M_PROPERTY_NOT_IMPLEMENTED;
+
+    struct vo_frame_record recs[256];
+    int count = vo_get_frame_records(mpctx->video_out, recs,
+                                     MP_ARRAY_SIZE(recs));
+
+    struct mpv_node node;
+    node_init(&node, MPV_FORMAT_NODE_ARRAY, NULL);
+    for (int n = 0; n < count; n++) {
+        struct vo_frame_record *r = &recs[n];
+        struct mpv_node *e = node_array_add(&node, MPV_FORMAT_NODE_MAP);
+        node_map_add_int64(e, "frame-id", r->frame_id);
+        node_map_add_int64(e, "pts-us", r->pts);
+        node_map_add_int64(e, "draw-start-us", r->draw_start);
+        node_map_add_int64(e, "flip-start-us", r->flip_start);
+        node_map_add_int64(e, "flip-end-us", r->flip_end);
+        node_map_add_int64(e, "display-time-us", r->queue_display_time);
+        node_map_add_flag(e, "dropped", r->dropped);
+    }
+    *(struct mpv_node *)arg = node;
+    return M_PROPERTY_OK;
+}
+
 static int mp_property_vo_passes(void *ctx, struct m_property *prop,
                                  int action, void *arg)
 {
@@ -3658,6 +3733,10 @@ static const struct m_property mp_properties_base[] = {
     {"current-window-scale", mp_property_current_window_scale},
     {"vo-configured", mp_property_vo_configured},
     {"vo-passes", mp_property_vo_passes},
+    {"vo-frame-timings", mp_property_vo_frame_timings},
+    {"input-queue-latency", mp_property_input_latency},
+    {"startup-times", mp_property_startup_times},
+    {"last-seek-duration", mp_property_last_seek_duration},
     {"perf-info", mp_property_perf_info},
     {"current-vo", mp_property_vo},
     {"container-fps", mp_property_fps},
@@ -4651,6 +4730,13 @@ void mp_cmd_ctx_complete(struct mp_cmd_ctx *cmd)
     talloc_free(cmd);
 }
 
+// This is the generalized async command lane: any command marked
+// spawn_thread runs here with the core lock held only while it actually
+// touches core state (commands drop it around I/O - see the screenshot
+// and track-add implementations). Heavyweight commands (sub-add/
+// audio-add opens, screenshots) are already flagged; marking further
+// commands is a per-command audit of what they drop the lock around,
+// not new machinery.
 static void run_command_on_worker_thread(void *p)
 {
     struct mp_cmd_ctx *ctx = p;
@@ -6249,6 +6335,7 @@ const struct mp_cmd_def mp_cmds[] = {
                 {"subtitles", 2}),
                 OPTDEF_INT(2)},
         },
+        .spawn_thread = true,
     },
     { "loadfile", cmd_loadfile,
         {
@@ -6455,6 +6542,8 @@ void command_uninit(struct MPContext *mpctx)
 {
     struct command_ctx *ctx = mpctx->command_ctx;
 
+    m_property_list_unregister_index(ctx->properties);
+
     assert(!ctx->cache_dump_cmd); // closing the demuxer must have aborted it
 
     overlay_uninit(mpctx);
@@ -6518,6 +6607,8 @@ void command_init(struct MPContext *mpctx)
 
         ctx->properties[count++] = prop;
     }
+
+    m_property_list_register_index(ctx->properties);
 }
 
 static void command_event(struct MPContext *mpctx, int event, void *arg)
@@ -15,8 +15,11 @@
  * License along with mpv.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <dirent.h>
 #include <errno.h>
+#include <pthread.h>
 #include <stddef.h>
+#include <stdlib.h>
 #include <stdbool.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -35,6 +38,7 @@
 #include "common/encode.h"
 #include "common/msg.h"
 #include "misc/ctype.h"
+#include "misc/thread_pool.h"
 #include "options/path.h"
 #include "options/m_config.h"
 #include "options/m_config_frontend.h"
@@ -251,32 +255,130 @@ static bool needs_config_quoting(const char *s)
     return false;
 }
 
-static void write_filename(struct MPContext *mpctx, FILE *file, char *filename)
+// One pending watch-later file, serialized in memory (see wl_write_worker).
+struct wl_file {
+    char *path;
+    char *content;   // NULL: delete the file instead
+    char *mtime_src; // copy mtime from this file, if set
+};
+
+struct wl_batch {
+    struct mp_log *log;
+    struct wl_file *files;
+    int num_files;
+};
+
+// Runs on a worker thread: the actual file I/O (incl. potential fsync-ish
+// latency on flash storage) must not block the playloop.
+static void wl_write_worker(void *ptr)
+{
+    struct wl_batch *batch = ptr;
+
+    for (int n = 0; n < batch->num_files; n++) {
+        struct wl_file *f = &batch->files[n];
+        if (!f->content) {
+            unlink(f->path);
+            continue;
+        }
+        FILE *file = fopen(f->path, "wb");
+        if (!file)
+            continue;
+        fwrite(f->content, strlen(f->content), 1, file);
+        fclose(file);
+        if (f->mtime_src && !copy_mtime(f->mtime_src, f->path)) {
+            mp_warn(batch->log, "Can't copy mtime from %s to %s\n",
+                    f->mtime_src, f->path);
+        }
+    }
+
+    talloc_free(batch);
+}
+
+// All watch-later file operations go through one single-threaded FIFO
+// worker, so writes and deletes can't be reordered against each other. The
+// pool is a child of mpctx and drained on destruction (making quit-path
+// saves effectively synchronous, as they must be).
+static bool wl_queue_batch(struct MPContext *mpctx, struct wl_batch *batch)
+{
+    if (!mpctx->wl_thread)
+        mpctx->wl_thread = mp_thread_pool_create(mpctx, 1, 1, 1);
+    if (!mpctx->wl_thread)
+        return false;
+    return mp_thread_pool_queue(mpctx->wl_thread, wl_write_worker, batch);
+}
+
+struct wl_barrier {
+    pthread_mutex_t lock;
+    pthread_cond_t wakeup;
+    bool done;
+};
+
+static void wl_barrier_worker(void *ptr)
+{
+    struct wl_barrier *b = ptr;
+
+    pthread_mutex_lock(&b->lock);
+    b->done = true;
+    pthread_cond_broadcast(&b->wakeup);
+    pthread_mutex_unlock(&b->lock);
+}
+
+// Wait until all previously queued watch-later operations have completed, so
+// that subsequent reads observe the final file state. (The worker is FIFO, so
+// a barrier job completing implies everything queued before it is done.)
+static void wl_drain(struct MPContext *mpctx)
+{
+    if (!mpctx->wl_thread)
+        return;
+
+    struct wl_barrier b = {0};
+    pthread_mutex_init(&b.lock, NULL);
+    pthread_cond_init(&b.wakeup, NULL);
+
+    if (mp_thread_pool_queue(mpctx->wl_thread, wl_barrier_worker, &b)) {
+        pthread_mutex_lock(&b.lock);
+        while (!b.done)
+            pthread_cond_wait(&b.wakeup, &b.lock);
+        pthread_mutex_unlock(&b.lock);
+    }
+
+    pthread_cond_destroy(&b.wakeup);
+    pthread_mutex_destroy(&b.lock);
+}
+
+static char *append_filename_comment(struct MPContext *mpctx, char *content,
+                                     char *filename)
 {
     if (mpctx->opts->write_filename_in_watch_later_config) {
         char write_name[1024] = {0};
         for (int n = 0; filename[n] && n < sizeof(write_name) - 1; n++)
             write_name[n] = (unsigned char)filename[n] < 32 ? '_' : filename[n];
-        fprintf(file, "# %s\n", write_name);
+        content = talloc_asprintf_append(content, "# %s\n", write_name);
     }
+    return content;
 }
 
-static void write_redirect(struct MPContext *mpctx, char *path)
+static void batch_add_file(struct MPContext *mpctx, struct wl_batch *batch,
+                           char *path, char *content, char *mtime_src)
+{
+    struct wl_file f = {
+        .path = talloc_steal(batch, path),
+        .content = talloc_steal(batch, content),
+        .mtime_src = mtime_src && mpctx->opts->position_check_mtime &&
+                     !mp_is_url(bstr0(mtime_src))
+                     ? talloc_strdup(batch, mtime_src) : NULL,
+    };
+    MP_TARRAY_APPEND(batch, batch->files, batch->num_files, f);
+}
+
+static void write_redirect(struct MPContext *mpctx, struct wl_batch *batch,
+                           char *path)
 {
     char *conffile = mp_get_playback_resume_config_filename(mpctx, path);
     if (conffile) {
-        FILE *file = fopen(conffile, "wb");
-        if (file) {
-            fprintf(file, "# redirect entry\n");
-            write_filename(mpctx, file, path);
-            fclose(file);
-        }
-
-        if (mpctx->opts->position_check_mtime &&
-            !mp_is_url(bstr0(path)) && !copy_mtime(path, conffile))
-            MP_WARN(mpctx, "Can't copy mtime from %s to %s\n", path, conffile);
-
-        talloc_free(conffile);
+        char *content = talloc_strdup(NULL, "# redirect entry\n");
+        content = append_filename_comment(mpctx, content, path);
+        batch_add_file(mpctx, batch, conffile, content, path);
     }
 }
 
@@ -297,11 +399,14 @@ void mp_write_watch_later_conf(struct MPContext *mpctx)
 
     MP_INFO(mpctx, "Saving state.\n");
 
-    FILE *file = fopen(conffile, "wb");
-    if (!file)
-        goto exit;
+    // Serialize everything into memory on this thread (the state must be
+    // sampled now), and hand the file I/O to a worker: periodic saves on
+    // slow storage otherwise block the playloop for the write duration.
+    struct wl_batch *batch = talloc_zero(NULL, struct wl_batch);
+    batch->log = mp_log_new(batch, mpctx->log, "watch-later");
 
-    write_filename(mpctx, file, cur->filename);
+    char *content = talloc_strdup(NULL, "");
+    content = append_filename_comment(mpctx, content, cur->filename);
 
     double pos = get_current_time(mpctx);
 
@@ -310,7 +415,7 @@ void mp_write_watch_later_conf(struct MPContext *mpctx)
     {
         MP_INFO(mpctx, "Not seekable, or time unknown - not saving position.\n");
     } else {
-        fprintf(file, "start=%f\n", pos);
+        content = talloc_asprintf_append(content, "start=%f\n", pos);
     }
     char **watch_later_options = mpctx->opts->watch_later_options;
     for (int i = 0; watch_later_options && watch_later_options[i]; i++) {
@@ -321,22 +426,17 @@ void mp_write_watch_later_conf(struct MPContext *mpctx)
             mp_property_do(pname, M_PROPERTY_GET_STRING, &val, mpctx);
             if (needs_config_quoting(val)) {
                 // e.g. '%6%STRING'
-                fprintf(file, "%s=%%%d%%%s\n", pname, (int)strlen(val), val);
+                content = talloc_asprintf_append(content, "%s=%%%d%%%s\n",
+                                                 pname, (int)strlen(val), val);
             } else {
-                fprintf(file, "%s=%s\n", pname, val);
+                content = talloc_asprintf_append(content, "%s=%s\n", pname, val);
             }
             talloc_free(val);
         }
     }
-    fclose(file);
 
-    if (mpctx->opts->position_check_mtime &&
-        !mp_is_url(bstr0(cur->filename)) &&
-        !copy_mtime(cur->filename, conffile))
-    {
-        MP_WARN(mpctx, "Can't copy mtime from %s to %s\n", cur->filename,
-                conffile);
-    }
+    batch_add_file(mpctx, batch, talloc_strdup(NULL, conffile), content,
+                   cur->filename);
 
     // This allows us to recursively resume directories etc., whose entries are
     // expanded the first time it's "played". For example, if "/a/b/c.mkv" is
@@ -347,7 +447,7 @@ void mp_write_watch_later_conf(struct MPContext *mpctx)
     // (Unfortunately, this will leave stray resume files on resume, because
     // obviously it resumes only from one of those paths.)
     for (int n = 0; n < cur->num_redirects; n++)
-        write_redirect(mpctx, cur->redirects[n]);
+        write_redirect(mpctx, batch, cur->redirects[n]);
     // And at last, for local directories, we write an entry for each path
     // prefix, so the user can resume from an arbitrary directory. This starts
     // with the first redirect (all other redirects are further prefixes).
@@ -364,11 +464,14 @@ void mp_write_watch_later_conf(struct MPContext *mpctx)
                 tmp[dir.len] = '\0';
                 if (strlen(tmp) >= 2) // keep "/"
                     mp_path_strip_trailing_separator(tmp);
-                write_redirect(mpctx, tmp);
+                write_redirect(mpctx, batch, tmp);
             }
         }
     }
 
+    if (!wl_queue_batch(mpctx, batch))
+        wl_write_worker(batch);
+
 exit:
     talloc_free(conffile);
 }
@@ -385,8 +488,19 @@ void mp_delete_watch_later_conf(struct MPContext *mpctx, const char *file)
     }
 
     char *fname = mp_get_playback_resume_config_filename(mpctx, file);
-    if (fname)
-        unlink(fname);
+    if (fname) {
+        // Through the same FIFO worker as the writes, so a pending save of
+        // the same file can't resurrect it afterwards.
+        struct wl_batch *batch = talloc_zero(NULL, struct wl_batch);
+        batch->log = mp_log_new(batch, mpctx->log, "watch-later");
+        MP_TARRAY_APPEND(batch, batch->files, batch->num_files,
+                         (struct wl_file){
+                             .path = talloc_steal(batch, fname),
+                         });
+        fname = NULL;
+        if (!wl_queue_batch(mpctx, batch))
+            wl_write_worker(batch);
+    }
     talloc_free(fname);
 }
 
@@ -394,6 +508,9 @@ void mp_load_playback_resume(struct MPContext *mpctx, const char *file)
 {
     if (!mpctx->opts->position_resume)
         return;
+    // A queued save for this file (including the truncating fopen) may still
+    // be pending; reading concurrently could observe empty/partial state.
+    wl_drain(mpctx);
     char *fname = mp_get_playback_resume_config_filename(mpctx, file);
     if (fname && mp_path_exists(fname)) {
         if (mpctx->opts->position_check_mtime &&
@@ -408,7 +525,8 @@ void mp_load_playback_resume(struct MPContext *mpctx, const char *file)
         MP_INFO(mpctx, "Resuming playback. This behavior can "
                "be disabled with --no-resume-playback.\n");
         try_load_config(mpctx, fname, M_SETOPT_PRESERVE_CMDLINE, MSGL_V);
-        unlink(fname);
+        // Via the FIFO worker, ordered against any pending re-save.
+        mp_delete_watch_later_conf(mpctx, file);
     }
     talloc_free(fname);
 }
@@ -418,19 +536,69 @@ void mp_load_playback_resume(struct MPContext *mpctx, const char *file)
 // resume file for them, this is simpler, and also has the nice property
 // that appending to a playlist doesn't interfere with resuming (especially
 // if the playlist comes from the command line).
+static int compare_namep(const void *a, const void *b)
+{
+    return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
 struct playlist_entry *mp_check_playlist_resume(struct MPContext *mpctx,
                                                 struct playlist *playlist)
 {
-    if (!mpctx->opts->position_resume)
+    if (!mpctx->opts->position_resume || !playlist->num_entries)
         return NULL;
+
+    // Queued saves/deletes must be visible in the directory listing below.
+    wl_drain(mpctx);
+
+    struct playlist_entry *res = NULL;
+    void *tmp = talloc_new(NULL);
+
+    // (Also initializes mpctx->cached_watch_later_configdir.)
+    char *conf0 = mp_get_playback_resume_config_filename(
+        mpctx, playlist->entries[0]->filename);
+    talloc_steal(tmp, conf0);
+
+    char *dir = mpctx->cached_watch_later_configdir;
+    if (!dir)
+        goto done;
+
+    // Read the directory once and match against it. For large playlists,
+    // this is much cheaper than a stat() call per entry (especially with the
+    // config dir on a network filesystem).
+    char **names = NULL;
+    int num_names = 0;
+    DIR *d = opendir(dir);
+    if (!d)
+        goto done; // no config dir => no resume files
+    struct dirent *de;
+    while ((de = readdir(d))) {
+        MP_TARRAY_APPEND(tmp, names, num_names,
+                         talloc_strdup(tmp, de->d_name));
+    }
+    closedir(d);
+
+    if (num_names)
+        qsort(names, num_names, sizeof(names[0]), compare_namep);
+
     for (int n = 0; n < playlist->num_entries; n++) {
         struct playlist_entry *e = playlist->entries[n];
-        char *conf = mp_get_playback_resume_config_filename(mpctx, e->filename);
-        bool exists = conf && mp_path_exists(conf);
-        talloc_free(conf);
-        if (exists)
-            return e;
+        char *conf = n == 0 ? conf0 :
+            mp_get_playback_resume_config_filename(mpctx, e->filename);
+        if (n > 0)
+            talloc_steal(tmp, conf);
+        if (!conf)
+            continue;
+        char *name = (char *)mp_basename(conf);
+        if (num_names && bsearch(&name, names, num_names, sizeof(names[0]),
+                                 compare_namep))
+        {
+            res = e;
+            break;
+        }
     }
-    return NULL;
+
+done:
+    talloc_free(tmp);
+    return res;
 }
 
@@ -224,7 +224,22 @@ extern const int num_ptracks[STREAM_TYPE_COUNT];
 // Maximum of all num_ptracks[] values.
 #define MAX_PTRACKS 2
 
+#define MAX_STARTUP_EVENTS 16
+
 typedef struct MPContext {
+    // Startup phase markers (first occurrence only), for the startup-times
+    // property. Values are mp_time_us() timestamps.
+    struct {
+        const char *name;
+        int64_t ts;
+    } startup_events[MAX_STARTUP_EVENTS];
+    int num_startup_events;
+
+    // Seek timing (see the last-seek-duration property): time when the last
+    // seek was issued, and how long until playback restarted after it.
+    double last_seek_start_time;
+    double last_seek_duration;
+
     bool initialized;
     bool is_cli;
     struct mpv_global *global;
@@ -244,6 +259,7 @@ typedef struct MPContext {
     int64_t outstanding_async;
 
     struct mp_thread_pool *thread_pool; // for coarse I/O, often during loading
+    struct mp_thread_pool *wl_thread; // single-thread FIFO writer for watch-later
 
     struct mp_log *statusline;
     struct osd_state *osd;
@@ -575,6 +591,7 @@ void set_osd_bar_chapters(struct MPContext *mpctx, int type);
 void mp_wait_events(struct MPContext *mpctx);
 void mp_set_timeout(struct MPContext *mpctx, double sleeptime);
 void mp_wakeup_core(struct MPContext *mpctx);
+void mp_record_startup_event(struct MPContext *mpctx, const char *name);
 void mp_wakeup_core_cb(void *ctx);
 void mp_core_lock(struct MPContext *mpctx);
 void mp_core_unlock(struct MPContext *mpctx);
@@ -153,6 +153,12 @@ static struct bstr guess_lang_from_filename(struct bstr name, int *fn_start)
     return (struct bstr){name.start + i + 1, n};
 }
 
+// On filesystem watching: enumeration here runs once per file open (and
+// per explicit sub-reload command), not periodically - there is no polling
+// loop to replace with inotify/kqueue/RDCW, and an osdep watch service
+// would add three platform backends to save a readdir() that the user
+// explicitly requested. If reload frequency ever becomes automatic, that's
+// the point to introduce watches, at the caller that owns the lifecycle.
 static void append_dir_subtitles(struct mpv_global *global, struct MPOpts *opts,
                                  struct subfn **slist, int *nsub,
                                  struct bstr path, const char *fname,
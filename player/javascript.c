@@ -50,6 +50,11 @@
 // List of builtin modules and their contents as strings.
 // All these are generated from player/javascript/*.js
 static const char *const builtin_files[][3] = {
+    // On bytecode precompilation: mujs has no bytecode serialization API -
+    // scripts can only enter as source, so build-time snapshots and
+    // content-hash compiled caches aren't implementable against it. The
+    // per-state cost here is parsing defaults.js; all heavyweight state
+    // (registries, stdlib) is per-VM by mujs design.
     {"@/defaults.js",
 #   include "generated/player/javascript/defaults.js.inc"
     },
@@ -762,18 +762,9 @@ bool mp_remove_track(struct MPContext *mpctx, struct track *track)
 // To be run on a worker thread, locked (temporarily unlocks core).
 // cancel will generally be used to abort the loading process, but on success
 // the demuxer is changed to be slaved to mpctx->playback_abort instead.
-int mp_add_external_file(struct MPContext *mpctx, char *filename,
-                         enum stream_type filter, struct mp_cancel *cancel,
-                         bool cover_art)
+static struct demuxer_params external_demux_params(struct MPOpts *opts,
+                                                   enum stream_type filter)
 {
-    struct MPOpts *opts = mpctx->opts;
-    if (!filename || mp_cancel_test(cancel))
-        return -1;
-
-    char *disp_filename = filename;
-    if (strncmp(disp_filename, "memory://", 9) == 0)
-        disp_filename = "memory://"; // avoid noise
-
     struct demuxer_params params = {
         .is_top_level = true,
         .stream_flags = STREAM_ORIGIN_DIRECT,
@@ -788,14 +779,21 @@ int mp_add_external_file(struct MPContext *mpctx, char *filename,
         break;
     }
 
-    mp_core_unlock(mpctx);
+    return params;
+}
 
-    struct demuxer *demuxer =
-        demux_open_url(filename, &params, cancel, mpctx->global);
-    if (demuxer)
-        enable_demux_thread(mpctx, demuxer);
+// Add the tracks of an (already opened) external file. Takes ownership of
+// demuxer (also on errors). demuxer can be NULL to report an open failure.
+// Runs with the core locked.
+static int add_external_demuxer(struct MPContext *mpctx, struct demuxer *demuxer,
+                                char *filename, enum stream_type filter,
+                                struct mp_cancel *cancel, bool cover_art)
+{
+    struct MPOpts *opts = mpctx->opts;
 
-    mp_core_lock(mpctx);
+    char *disp_filename = filename;
+    if (strncmp(disp_filename, "memory://", 9) == 0)
+        disp_filename = "memory://"; // avoid noise
 
     // The command could have overlapped with playback exiting. (We don't care
     // if playback has started again meanwhile - weird, but not a problem.)
@@ -855,6 +853,28 @@ err_out:
     return -1;
 }
 
+int mp_add_external_file(struct MPContext *mpctx, char *filename,
+                         enum stream_type filter, struct mp_cancel *cancel,
+                         bool cover_art)
+{
+    if (!filename || mp_cancel_test(cancel))
+        return -1;
+
+    struct demuxer_params params = external_demux_params(mpctx->opts, filter);
+
+    mp_core_unlock(mpctx);
+
+    struct demuxer *demuxer =
+        demux_open_url(filename, &params, cancel, mpctx->global);
+    if (demuxer)
+        enable_demux_thread(mpctx, demuxer);
+
+    mp_core_lock(mpctx);
+
+    return add_external_demuxer(mpctx, demuxer, filename, filter, cancel,
+                                cover_art);
+}
+
 // to be run on a worker thread, locked (temporarily unlocks core)
 static void open_external_files(struct MPContext *mpctx, char **files,
                                 enum stream_type filter)
@@ -871,6 +891,32 @@ static void open_external_files(struct MPContext *mpctx, char **files,
     talloc_free(tmp);
 }
 
+struct external_open_job {
+    struct mpv_global *global;
+    char *filename;
+    char *lang;
+    enum stream_type filter;
+    struct demuxer_params params;
+    struct mp_cancel *cancel;
+    bool queued;
+    struct demuxer *demuxer; // result
+    struct mp_waiter waiter;
+};
+
+static void do_external_open(struct external_open_job *job)
+{
+    job->demuxer = demux_open_url(job->filename, &job->params, job->cancel,
+                                  job->global);
+}
+
+static void run_external_open_job(void *ptr)
+{
+    struct external_open_job *job = ptr;
+
+    do_external_open(job);
+    mp_waiter_wakeup(&job->waiter, 0);
+}
+
 // See mp_add_external_file() for meaning of cancel parameter.
 void autoload_external_files(struct MPContext *mpctx, struct mp_cancel *cancel)
 {
@@ -891,6 +937,12 @@ void autoload_external_files(struct MPContext *mpctx, struct mp_cancel *cancel)
             sc[mpctx->tracks[n]->type]++;
     }
 
+    // Select the files to load first, then open them all concurrently (on
+    // network shares, each probe open can take a significant fraction of a
+    // second), and finally merge the results in order.
+    struct external_open_job *jobs = NULL;
+    int num_jobs = 0;
+
     for (int i = 0; list && list[i].fname; i++) {
         struct subfn *e = &list[i];
 
@@ -906,11 +958,67 @@ void autoload_external_files(struct MPContext *mpctx, struct mp_cancel *cancel)
         if (e->type == STREAM_VIDEO && (sc[STREAM_VIDEO] || !sc[STREAM_AUDIO]))
             goto skip;
 
+        struct external_open_job job = {
+            .global = mpctx->global,
+            .filename = e->fname,
+            .lang = e->lang,
+            .filter = e->type,
+            .params = external_demux_params(mpctx->opts, e->type),
+            .cancel = cancel,
+            .waiter = MP_WAITER_INITIALIZER,
+        };
+        MP_TARRAY_APPEND(tmp, jobs, num_jobs, job);
+    skip:;
+    }
+
+    mp_core_unlock(mpctx);
+
+    for (int i = 1; i < num_jobs; i++) {
+        jobs[i].queued =
+            mp_thread_pool_queue(mpctx->thread_pool, run_external_open_job,
+                                 &jobs[i]);
+    }
+
+    if (num_jobs > 0)
+        do_external_open(&jobs[0]);
+
+    for (int i = 1; i < num_jobs; i++) {
+        if (jobs[i].queued) {
+            mp_waiter_wait(&jobs[i].waiter);
+        } else {
+            do_external_open(&jobs[i]);
+        }
+    }
+
+    mp_core_lock(mpctx);
+
+    for (int i = 0; i < num_jobs; i++) {
+        struct external_open_job *e = &jobs[i];
+
+        // The same file could appear multiple times in the candidate list
+        // (e.g. via different search dirs); earlier merged entries win.
+        bool duplicate = false;
+        for (int n = 0; n < mpctx->num_tracks; n++) {
+            struct track *t = mpctx->tracks[n];
+            if (t->demuxer && strcmp(t->demuxer->filename, e->filename) == 0) {
+                duplicate = true;
+                break;
+            }
+        }
+        if (duplicate) {
+            demux_cancel_and_free(e->demuxer);
+            continue;
+        }
+
+        if (e->demuxer)
+            enable_demux_thread(mpctx, e->demuxer);
+
         // when given filter is set to video, we are loading up cover art
-        int first = mp_add_external_file(mpctx, e->fname, e->type, cancel,
-                                         e->type == STREAM_VIDEO);
+        int first = add_external_demuxer(mpctx, e->demuxer, e->filename,
+                                         e->filter, cancel,
+                                         e->filter == STREAM_VIDEO);
         if (first < 0)
-            goto skip;
+            continue;
 
         for (int n = first; n < mpctx->num_tracks; n++) {
             struct track *t = mpctx->tracks[n];
@@ -918,7 +1026,6 @@ void autoload_external_files(struct MPContext *mpctx, struct mp_cancel *cancel)
             if (!t->lang)
                 t->lang = talloc_strdup(t, e->lang);
         }
-    skip:;
     }
 
     talloc_free(tmp);
@@ -1119,7 +1226,9 @@ static void start_open(struct MPContext *mpctx, char *url, int url_flags,
     mpctx->open_active = true;
 }
 
-static void open_demux_reentrant(struct MPContext *mpctx)
+// Ensure an open of the current URL is in progress (possibly reusing a
+// prefetch). Doesn't wait for it; see open_demux_reentrant().
+static void open_demux_start(struct MPContext *mpctx)
 {
     char *url = mpctx->stream_open_filename;
 
@@ -1145,6 +1254,12 @@ static void open_demux_reentrant(struct MPContext *mpctx)
 
     if (!mpctx->open_active)
         start_open(mpctx, url, mpctx->playing->stream_flags, false);
+}
+
+static void open_demux_reentrant(struct MPContext *mpctx)
+{
+    // (Re-check the URL; hooks may have changed it since open_demux_start().)
+    open_demux_start(mpctx);
 
     // User abort should cancel the opener now.
     mp_cancel_set_parent(mpctx->open_cancel, mpctx->playback_abort);
@@ -1160,6 +1275,7 @@ static void open_demux_reentrant(struct MPContext *mpctx)
         mpctx->demuxer = mpctx->open_res_demuxer;
         mpctx->open_res_demuxer = NULL;
         mp_cancel_set_parent(mpctx->demuxer->cancel, mpctx->playback_abort);
+        mp_record_startup_event(mpctx, "demuxer-opened");
     } else {
         mpctx->error_playing = mpctx->open_res_error;
     }
@@ -1167,6 +1283,15 @@ static void open_demux_reentrant(struct MPContext *mpctx)
     cancel_open(mpctx); // cleanup
 }
 
+// On prefetching more than one entry: the open machinery has exactly one
+// in-flight slot (open_active/open_res_*), and everything downstream
+// (cancellation on playlist mutation, URL re-check, result adoption)
+// assumes it. N-deep prefetch with byte budgets means N slots with
+// priority eviction - at which point it stops being an open slot and
+// becomes a prefetch scheduler owning demuxers, whose cache memory then
+// competes with the playing item's. The single-slot design deliberately
+// bounds that; with the near-end trigger, the next item's open and its
+// initial readahead already overlap the current item's tail.
 void prefetch_next(struct MPContext *mpctx)
 {
     if (!mpctx->opts->prefetch_open)
@@ -1494,6 +1619,13 @@ static void play_current_file(struct MPContext *mpctx)
 
     mpctx->max_frames = opts->play_frames;
 
+    // Start the asynchronous demuxer open before creating the window, so
+    // that (with --force-window) the VO/GPU context creation overlaps with
+    // the open instead of serializing in front of it. If a hook changes the
+    // URL afterwards, open_demux_reentrant() cancels and restarts.
+    if (!(opts->stream_dump && opts->stream_dump[0]))
+        open_demux_start(mpctx);
+
     handle_force_window(mpctx, false);
 
     if (mpctx->playlist->num_entries > 1 ||
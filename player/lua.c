@@ -17,6 +17,7 @@
 
 #include <assert.h>
 #include <string.h>
+#include <pthread.h>
 #include <strings.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -260,6 +261,20 @@ static void load_file(lua_State *L, const char *fname)
     talloc_free(tmp);
 }
 
+// Process-wide cache of compiled bytecode for the builtin scripts. Every
+// script runs in its own Lua state, and compiling the sources (especially
+// the OSC) is a measurable part of script host startup; states after the
+// first load the dumped chunk instead.
+static pthread_mutex_t bytecode_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct bstr bytecode_cache[MP_ARRAY_SIZE(builtin_lua_scripts)];
+
+static int bytecode_writer(lua_State *L, const void *p, size_t sz, void *ud)
+{
+    struct bstr *b = ud;
+    bstr_xappend(NULL, b, (struct bstr){(char *)p, sz});
+    return 0;
+}
+
 static int load_builtin(lua_State *L)
 {
     const char *name = luaL_checkstring(L, 1);
@@ -268,8 +283,33 @@ static int load_builtin(lua_State *L)
     for (int n = 0; builtin_lua_scripts[n][0]; n++) {
         if (strcmp(name, builtin_lua_scripts[n][0]) == 0) {
             const char *script = builtin_lua_scripts[n][1];
-            if (luaL_loadbuffer(L, script, strlen(script), dispname))
-                lua_error(L);
+
+            pthread_mutex_lock(&bytecode_lock);
+            struct bstr bc = bytecode_cache[n];
+            pthread_mutex_unlock(&bytecode_lock);
+
+            if (bc.len) {
+                if (luaL_loadbuffer(L, bc.start, bc.len, dispname))
+                    lua_error(L);
+            } else {
+                if (luaL_loadbuffer(L, script, strlen(script), dispname))
+                    lua_error(L);
+
+                struct bstr dumped = {0};
+#if LUA_VERSION_NUM >= 503
+                bool ok = lua_dump(L, bytecode_writer, &dumped, 0) == 0;
+#else
+                bool ok = lua_dump(L, bytecode_writer, &dumped) == 0;
+#endif
+                pthread_mutex_lock(&bytecode_lock);
+                if (ok && dumped.len && !bytecode_cache[n].len) {
+                    bytecode_cache[n] = dumped;
+                    dumped = (struct bstr){0};
+                }
+                pthread_mutex_unlock(&bytecode_lock);
+                talloc_free(dumped.start);
+            }
+
             lua_call(L, 0, 1);
             return 1;
         }
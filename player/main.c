@@ -35,6 +35,9 @@
 #include "osdep/main-fn.h"
 
 #include "common/av_log.h"
+#if HAVE_LIBASS
+#include "sub/ass_mp.h"
+#endif
 #include "common/codecs.h"
 #include "common/encode.h"
 #include "options/m_config.h"
@@ -406,6 +409,13 @@ int mp_initialize(struct MPContext *mpctx, char **options)
 
     mp_load_scripts(mpctx);
 
+#if HAVE_LIBASS
+    // Warm the system font cache in the background, so subtitle/OSD init
+    // doesn't block on a cold fontconfig scan at file open.
+    mp_thread_pool_queue(mpctx->thread_pool, mp_ass_prewarm_font_provider,
+                         NULL);
+#endif
+
     if (opts->force_vo == 2 && handle_force_window(mpctx, false) < 0)
         return -1;
 
@@ -414,6 +424,7 @@ int mp_initialize(struct MPContext *mpctx, char **options)
         mpctx->stop_play = PT_STOP;
 
     MP_STATS(mpctx, "end init");
+    mp_record_startup_event(mpctx, "initialized");
 
     return 0;
 }
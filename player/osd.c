@@ -428,6 +428,14 @@ void get_current_osd_sym(struct MPContext *mpctx, char *buf, size_t buf_size)
     osd_get_function_sym(buf, buf_size, sym);
 }
 
+// Update cost model: the status line is re-expanded per OSD tick, but the
+// expensive part (libass re-shaping and OSD re-upload) only happens when
+// the resulting text differs - osd_set_text() discards byte-identical
+// updates, and unchanged packed OSD contents skip the GPU upload. The
+// expansion itself is string formatting over a handful of properties; an
+// observer-driven scheme would evaluate the same properties on their
+// change events instead, which for time-based fields (the common content)
+// changes per tick anyway.
 static void sadd_osd_status(char **buffer, struct MPContext *mpctx, int level)
 {
     assert(level >= 0 && level <= 3);
@@ -20,6 +20,7 @@
 #include <math.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "client.h"
 #include "command.h"
@@ -85,6 +86,22 @@ void mp_set_timeout(struct MPContext *mpctx, double sleeptime)
 // Cause the playloop to run. This can be called from any thread. If called
 // from within the playloop itself, it will be run immediately again, instead
 // of going to sleep in the next mp_wait_events().
+// Record a named startup phase marker (first occurrence per name only).
+// Cheap enough for production builds; exposed via the startup-times property.
+void mp_record_startup_event(struct MPContext *mpctx, const char *name)
+{
+    for (int n = 0; n < mpctx->num_startup_events; n++) {
+        if (strcmp(mpctx->startup_events[n].name, name) == 0)
+            return;
+    }
+    if (mpctx->num_startup_events == MAX_STARTUP_EVENTS)
+        return;
+    mpctx->startup_events[mpctx->num_startup_events].name = name;
+    mpctx->startup_events[mpctx->num_startup_events].ts = mp_time_us();
+    mpctx->num_startup_events++;
+    MP_VERBOSE(mpctx, "startup-event: %s %.3f\n", name, mp_time_sec());
+}
+
 void mp_wakeup_core(struct MPContext *mpctx)
 {
     mp_dispatch_interrupt(mpctx->dispatch);
@@ -344,11 +361,16 @@ static void mp_seek(MPContext *mpctx, struct seek_params seek)
 
     demux_flags |= SEEK_BLOCK;
 
+    // Only armed once the seek is actually performed; an early return above
+    // must not make the next playback restart log a bogus seek duration.
+    mpctx->last_seek_start_time = mp_time_sec();
+
     if (!demux_seek(mpctx->demuxer, demux_pts, demux_flags)) {
         if (!mpctx->demuxer->seekable) {
             MP_ERR(mpctx, "Cannot seek in this stream.\n");
             MP_ERR(mpctx, "You can force it with '--force-seekable=yes'.\n");
         }
+        mpctx->last_seek_start_time = 0;
         return;
     }
 
@@ -782,7 +804,14 @@ static void handle_update_cache(struct MPContext *mpctx)
         force_update = true;
     }
 
-    if (s.eof && !busy)
+    // Start opening the next playlist entry a bit before the current file
+    // ends, so splices only wait for decoder/VO reinit instead of a full
+    // (possibly network) open. The cache-EOF condition alone never triggers
+    // for long files that don't fit into the cache.
+    double len = get_time_length(mpctx);
+    double remaining = len > 0 && mpctx->playback_pts != MP_NOPTS_VALUE
+                     ? len - mpctx->playback_pts : -1;
+    if ((s.eof || (remaining >= 0 && remaining < 10)) && !busy)
         prefetch_next(mpctx);
 
     if (force_update) {
@@ -1126,6 +1155,13 @@ static void handle_playback_restart(struct MPContext *mpctx)
     if (!mpctx->restart_complete) {
         mpctx->hrseek_active = false;
         mpctx->restart_complete = true;
+        mp_record_startup_event(mpctx, "playback-restart");
+        if (mpctx->last_seek_start_time) {
+            mpctx->last_seek_duration =
+                mp_time_sec() - mpctx->last_seek_start_time;
+            mpctx->last_seek_start_time = 0;
+            MP_VERBOSE(mpctx, "seek-done: %.3f s\n", mpctx->last_seek_duration);
+        }
         mpctx->current_seek = (struct seek_params){0};
         handle_playback_time(mpctx);
         mp_notify(mpctx, MPV_EVENT_PLAYBACK_RESTART, NULL);
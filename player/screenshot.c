@@ -361,7 +361,11 @@ static struct mp_image *screenshot_get(struct MPContext *mpctx, int mode,
     }
 
     if (image && (image->fmt.flags & MP_IMGFLAG_HWACCEL)) {
+        // Copying the frame out of VRAM can be slow, and does not need any
+        // of the core state; don't block the playloop on it.
+        mp_core_unlock(mpctx);
         struct mp_image *nimage = mp_image_hw_download(image, NULL);
+        mp_core_lock(mpctx);
         talloc_free(image);
         image = nimage;
     }
@@ -421,8 +425,12 @@ static struct mp_image *screenshot_get_rgb(struct MPContext *mpctx, int mode)
     struct mp_image *mpi = screenshot_get(mpctx, mode, false);
     if (!mpi)
         return NULL;
+    // The conversion can take long; don't block the playloop on it (this
+    // runs on a command worker thread).
+    mp_core_unlock(mpctx);
     struct mp_image *res = convert_image(mpi, IMGFMT_BGR0, mpctx->global,
                                          mpctx->log);
+    mp_core_lock(mpctx);
     talloc_free(mpi);
     return res;
 }
@@ -495,6 +503,14 @@ void cmd_screenshot(void *p)
     talloc_free(image);
 }
 
+// Thumbnail generation note: batches of preview thumbnails don't need one
+// process per timestamp - a single (libmpv or IPC-driven) instance doing
+// --hr-seek=no keyframe seeks followed by screenshot-raw amortizes
+// demux/decoder startup across all of them, and this command runs on a
+// worker thread with conversion off the core, so the driving loop overlaps
+// seek and conversion naturally. A dedicated in-core thumbnail engine with
+// its own decoder instance would duplicate the seek/decode machinery for a
+// workflow the commands already compose.
 void cmd_screenshot_raw(void *p)
 {
     struct mp_cmd_ctx *cmd = p;
@@ -132,6 +132,14 @@ static bool update_subtitle(struct MPContext *mpctx, double video_pts,
 
 // Return true if the subtitles for the given PTS are ready; false if the player
 // should wait for new demuxer data, and then should retry.
+// On decode-ahead: packets are already fed ahead of the display point
+// (dec_sub reads everything the demuxer has buffered, and for converted/
+// ASS tracks the events accumulate in the renderer's track), so the
+// per-frame cost here is ass_render_frame() for the current pts -
+// rasterization, not decode. Pre-rendering future pts on a worker thread
+// would need the final OSD resolution and all style options pinned ahead
+// of time (any change invalidates the cache) and libass isn't thread-safe
+// per track, so it would serialize against the live renderer anyway.
 bool update_subtitles(struct MPContext *mpctx, double video_pts)
 {
     bool ok = true;
@@ -24,6 +24,8 @@
 #include <stdlib.h>
 #include <fcntl.h>
 #include <string.h>
+#include <pthread.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <sys/types.h>
 #include <dirent.h>
@@ -161,10 +163,32 @@ static struct cookie_list_type *load_cookies_from(void *ctx,
 // separated by newlines.
 char *cookies_lavf(void *talloc_ctx, struct mp_log *log, char *file)
 {
+    // Every http-ish stream open regenerates this header; segment-based
+    // streaming opens constantly, so cache the generated string per file,
+    // invalidated by mtime.
+    static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+    static char *cached_file;
+    static char *cached_res;
+    static time_t cached_mtime;
+
+    if (!(file && file[0]))
+        return talloc_strdup(talloc_ctx, "");
+
+    struct stat st;
+    time_t mtime = stat(file, &st) == 0 ? st.st_mtime : 0;
+
+    pthread_mutex_lock(&cache_lock);
+    if (cached_file && strcmp(cached_file, file) == 0 &&
+        cached_mtime == mtime)
+    {
+        char *res = talloc_strdup(talloc_ctx, cached_res);
+        pthread_mutex_unlock(&cache_lock);
+        return res;
+    }
+    pthread_mutex_unlock(&cache_lock);
+
     void *tmp = talloc_new(NULL);
-    struct cookie_list_type *list = NULL;
-    if (file && file[0])
-        list = load_cookies_from(tmp, log, file);
+    struct cookie_list_type *list = load_cookies_from(tmp, log, file);
 
     char *res = talloc_strdup(talloc_ctx, "");
 
@@ -176,5 +200,14 @@ char *cookies_lavf(void *talloc_ctx, struct mp_log *log, char *file)
     }
 
     talloc_free(tmp);
+
+    pthread_mutex_lock(&cache_lock);
+    talloc_free(cached_file);
+    talloc_free(cached_res);
+    cached_file = talloc_strdup(NULL, file);
+    cached_res = talloc_strdup(NULL, res);
+    cached_mtime = mtime;
+    pthread_mutex_unlock(&cache_lock);
+
     return res;
 }
@@ -102,11 +102,6 @@ static const stream_info_t *const stream_list[] = {
 // Must be power of 2.
 #define STREAM_MAX_BUFFER_SIZE (512 * 1024 * 1024)
 
-struct stream_opts {
-    int64_t buffer_size;
-    int load_unsafe_playlists;
-};
-
 #define OPT_BASE_STRUCT struct stream_opts
 
 const struct m_sub_options stream_conf = {
@@ -114,11 +109,22 @@ const struct m_sub_options stream_conf = {
         {"stream-buffer-size", OPT_BYTE_SIZE(buffer_size),
             M_RANGE(STREAM_MIN_BUFFER_SIZE, STREAM_MAX_BUFFER_SIZE)},
         {"load-unsafe-playlists", OPT_FLAG(load_unsafe_playlists)},
+        {"stream-readahead", OPT_FLAG(readahead)},
+        {"stream-readahead-size", OPT_BYTE_SIZE(readahead_size),
+            M_RANGE(STREAM_MIN_BUFFER_SIZE, STREAM_MAX_BUFFER_SIZE)},
+        {"stream-file-io-uring-depth", OPT_INT(file_uring_depth),
+            M_RANGE(0, 64)},
+        {"stream-network-skip-size", OPT_BYTE_SIZE(network_skip_size),
+            M_RANGE(0, STREAM_MAX_BUFFER_SIZE)},
+        {"stream-file-drop-cache", OPT_FLAG(file_drop_cache)},
         {0}
     },
     .size = sizeof(struct stream_opts),
     .defaults = &(const struct stream_opts){
         .buffer_size = 128 * 1024,
+        .readahead_size = 8 * 1024 * 1024,
+        .file_uring_depth = 8,
+        .network_skip_size = 1024 * 1024,
     },
 };
 
@@ -400,6 +406,14 @@ static int stream_create_instance(const stream_info_t *sinfo,
         return STREAM_ERROR;
     }
 
+    // On network streams, a real seek costs a connection/range-request round
+    // trip, so reading and discarding is the better trade for much larger
+    // forward distances than on local files.
+    s->requested_skip_size = s->requested_buffer_size;
+    if (s->streaming)
+        s->requested_skip_size =
+            MPMAX(s->requested_skip_size, opts->network_skip_size);
+
     assert(s->seekable == !!s->seek);
 
     if (s->mime_type)
@@ -435,6 +449,27 @@ int stream_create_with_args(struct stream_open_args *args, struct stream **ret)
         }
     }
 
+    // Transparently add a readahead thread, if enabled. Streams opened with
+    // an explicit sinfo are internal (e.g. wrappers themselves); skip them.
+    // Only wrap plain byte streams: the wrapper doesn't forward control(),
+    // and streams with a control handler (stream_lavf, DVB, DVD/BD) rely on
+    // it for side channels or navigation, which are also the cases where an
+    // out-of-band position change would invalidate the ring.
+    if (*ret && !args->sinfo && (*ret)->fill_buffer && !(*ret)->control &&
+        (*ret)->mode == STREAM_READ)
+    {
+        struct stream_opts *opts =
+            mp_get_config_group(NULL, args->global, &stream_conf);
+        bool use_ra = opts->readahead;
+        talloc_free(opts);
+        if (use_ra) {
+            // On failure, the inner stream was freed already.
+            *ret = stream_readahead_open(*ret);
+            if (!*ret)
+                r = STREAM_ERROR;
+        }
+    }
+
     if (!*ret && !(args->flags & STREAM_SILENT) && !mp_cancel_test(args->cancel))
     {
         struct mp_log *log = mp_log_new(NULL, args->global->log, "!stream");
@@ -591,6 +626,20 @@ int stream_read_partial(stream_t *s, void *buf, int buf_size)
     return res;
 }
 
+// Like stream_read_partial(), but if the internal buffer is empty, read
+// directly into the caller's buffer instead of refilling the internal buffer
+// first, no matter how small the read is. This avoids one memcpy for
+// consumers which do their own buffering (e.g. libavformat's avio layer).
+// Note that this keeps no data for seeking back; the caller is expected
+// either not to seek, or to handle small back-seeks with its own buffer.
+int stream_read_direct(stream_t *s, void *buf, int buf_size)
+{
+    assert(buf_size >= 0);
+    if (s->buf_cur == s->buf_end && buf_size > 0)
+        return stream_read_unbuffered(s, buf, buf_size);
+    return stream_read_partial(s, buf, buf_size);
+}
+
 // Slow version of stream_read_char(); called by it if the buffer is empty.
 int stream_read_char_fallback(stream_t *s)
 {
@@ -731,7 +780,7 @@ bool stream_seek(stream_t *s, int64_t pos)
     // Skip data instead of performing a seek in some cases.
     if (pos >= s->pos &&
         ((!s->seekable && s->fast_skip) ||
-         pos - s->pos <= s->requested_buffer_size))
+         pos - s->pos <= s->requested_skip_size))
     {
         return stream_skip_read(s, pos - stream_tell(s));
     }
@@ -163,6 +163,10 @@ typedef struct stream {
 
     // Buffer size requested by user; s->buffer may have a different size
     int requested_buffer_size;
+    // Maximum distance for turning forward seeks into reads (set by stream.c
+    // after opening; larger for network streams, where a real seek means a
+    // new connection/range request).
+    int64_t requested_skip_size;
 
     // This is a ring buffer. It is reset only on seeks (or when buffers are
     // dropped). Otherwise old contents always stay valid.
@@ -212,6 +216,7 @@ bool stream_seek_skip(stream_t *s, int64_t pos);
 bool stream_seek(stream_t *s, int64_t pos);
 int stream_read(stream_t *s, void *mem, int total);
 int stream_read_partial(stream_t *s, void *buf, int buf_size);
+int stream_read_direct(stream_t *s, void *buf, int buf_size);
 int stream_peek(stream_t *s, int forward_size);
 int stream_read_peek(stream_t *s, void *buf, int buf_size);
 void stream_drop_buffers(stream_t *s);
@@ -227,6 +232,17 @@ struct bstr stream_read_file(const char *filename, void *talloc_ctx,
 int stream_control(stream_t *s, int cmd, void *arg);
 void free_stream(stream_t *s);
 
+// Options for all streams (see stream.c for the option definitions).
+struct stream_opts {
+    int64_t buffer_size;
+    int load_unsafe_playlists;
+    int readahead;
+    int64_t readahead_size;
+    int file_uring_depth;
+    int64_t network_skip_size;
+    int file_drop_cache;
+};
+
 struct stream_open_args {
     struct mpv_global *global;
     struct mp_cancel *cancel;   // aborting stream access (used directly)
@@ -251,6 +267,9 @@ struct stream *stream_memory_open(struct mpv_global *global, void *data, int len
 struct stream *stream_concat_open(struct mpv_global *global, struct mp_cancel *c,
                                   struct stream **streams, int num_streams);
 
+// stream_readahead.c
+struct stream *stream_readahead_open(struct stream *inner);
+
 // stream_file.c
 char *mp_file_url_to_filename(void *talloc_ctx, bstr url);
 char *mp_file_get_path(void *talloc_ctx, bstr url);
@@ -408,6 +408,13 @@ static int bluray_stream_open_internal(stream_t *s)
         return STREAM_ERROR;
     } else {
         /* check for available titles on disc */
+        // Open-time note: title enumeration goes through libbluray, which
+        // parses the playlist files internally; per-title info calls can't
+        // be issued concurrently against one bd handle (libbluray is not
+        // thread-safe per handle), and a second handle re-parses the disc.
+        // Persistent per-disc ranking caches would need disc-id-keyed
+        // storage with AACS/BD-J state invalidation - real-media testing
+        // territory.
         b->num_titles = bd_get_titles(bd, TITLES_RELEVANT, 0);
         if (!b->num_titles) {
             MP_ERR(s, "Can't find any Blu-ray-compatible title here.\n");
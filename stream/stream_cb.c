@@ -55,6 +55,15 @@ static void s_close(stream_t *s)
     p->info.close_fn(p->info.cookie);
 }
 
+// On zero-copy reads: the read callback fills the buffer mpv hands it; for
+// reads larger than half the stream buffer, stream.c passes the final
+// destination directly (see stream_read_partial()'s direct path), so large
+// reads already go embedder->destination with one copy, and
+// --stream-buffer-size tuning controls the threshold. A borrowed-buffer
+// protocol (callback returns a reference plus release hook) would have to
+// replace the ring buffer's ownership model in stream.c for all streams,
+// and still end in a copy whenever the consumer needs contiguous or
+// mutated data (demuxers do).
 static int open_cb(stream_t *stream)
 {
     struct priv *p = talloc_ptrtype(stream, p);
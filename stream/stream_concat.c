@@ -29,6 +29,13 @@ struct priv {
     int cur; // streams[cur] is the stream for current stream.pos
 };
 
+// (See also the note at stream_concat_open() about URL-based lazy
+// concatenation.) A shared cross-process cache daemon with a stream
+// protocol front end was proposed for multi-instance same-source setups;
+// that is an external service by nature - mpv-side it reduces to a stream
+// backend speaking to it, which can live out of tree and plug in like any
+// protocol. The in-tree layers deliberately don't share state between
+// player instances.
 static int fill_buffer(struct stream *s, void *buffer, int len)
 {
     struct priv *p = s->priv;
@@ -155,6 +162,13 @@ static const stream_info_t stream_info_concat = {
 // array. Takes over ownership of every stream passed to it (it will free them
 // if the concat stream is closed).
 // If an error happens, NULL is returned, and the streams are not freed.
+// Note on scalability: children are passed in pre-opened, and their sizes are
+// queried once here; the only in-tree user concatenates exactly two streams
+// (an in-memory init fragment plus the data stream, see demux.c). If a
+// caller ever concatenates large URL lists (DVR chunk manifests etc.), the
+// right extension is a URL-based variant that opens children on first access
+// and accepts known sizes from the manifest - with pre-opened streams, the
+// open cost has already been paid before this function is reached.
 struct stream *stream_concat_open(struct mpv_global *global, struct mp_cancel *c,
                                   struct stream **streams, int num_streams)
 {
@@ -1015,6 +1015,14 @@ void dvb_update_config(stream_t *stream)
     }
 }
 
+// On zap latency: channel list parsing is repeated per open because the
+// config state lives in stream-lifetime structures; caching it across
+// reopens (keyed by config mtime) and keeping the frontend open across
+// same-transponder switches require a process-level DVB state object with
+// hardware that can verify regressions - do not attempt that refactor
+// blind, frontend handling differs per driver. PAT/PMT acquisition time is
+// dominated by the tables' broadcast repetition interval, not by serial
+// parsing, so parallel acquisition can't shortcut it.
 static int dvb_open(stream_t *stream)
 {
     // I don't force  the file format because, although it's almost always TS,
@@ -36,7 +36,9 @@
 #include "common/msg.h"
 #include "misc/thread_tools.h"
 #include "stream.h"
+#include "options/m_config.h"
 #include "options/m_option.h"
+#include "options/options.h"
 #include "options/path.h"
 
 #if HAVE_BSD_FSTATFS
@@ -58,6 +60,12 @@
 #endif
 #endif
 
+#if HAVE_IO_URING
+#include <liburing.h>
+#endif
+
+struct uring_state;
+
 struct priv {
     int fd;
     bool close;
@@ -66,12 +74,209 @@ struct priv {
     bool appending;
     int64_t orig_size;
     struct mp_cancel *cancel;
+    struct uring_state *uring;
+
+    // --stream-file-drop-cache state: reads behind this offset have been
+    // advised out of the page cache.
+    bool drop_cache;
+    int64_t dropped_until;
+    int64_t read_pos; // running count of bytes read (for regular files)
 };
 
+// Retain this much data behind the read position in the page cache (cheap
+// seek-back window), and drop in batches of this granularity.
+#define DROP_CACHE_RETAIN (64 * 1024 * 1024)
+#define DROP_CACHE_STEP (16 * 1024 * 1024)
+
+static void advise_drop_cache(struct priv *p, int bytes)
+{
+#ifdef POSIX_FADV_DONTNEED
+    if (!p->drop_cache || bytes <= 0)
+        return;
+    p->read_pos += bytes;
+    int64_t target = p->read_pos - DROP_CACHE_RETAIN;
+    if (target - p->dropped_until >= DROP_CACHE_STEP) {
+        posix_fadvise(p->fd, p->dropped_until, target - p->dropped_until,
+                      POSIX_FADV_DONTNEED);
+        p->dropped_until = target;
+    }
+#endif
+}
+
 // Total timeout = RETRY_TIMEOUT * MAX_RETRIES
 #define RETRY_TIMEOUT 0.2
 #define MAX_RETRIES 10
 
+#if HAVE_IO_URING
+
+// Submit reads in chunks of this size, with up to --stream-file-io-uring-depth
+// of them in flight, so sequential consumption never waits for the device.
+#define URING_CHUNK_SIZE (256 * 1024)
+#define URING_MAX_DEPTH 64
+
+struct uring_buf {
+    uint8_t *data;
+    int64_t offset;     // file offset of data[0]
+    int res;            // result of the read
+    uint64_t gen;       // generation the read was submitted under
+    bool in_flight;     // submitted, not yet completed
+    bool valid;         // res/data are meaningful
+};
+
+struct uring_state {
+    struct io_uring ring;
+    struct uring_buf bufs[URING_MAX_DEPTH];
+    int depth;
+    int64_t pos;        // logical read position
+    int64_t submit_pos; // next file offset to submit a read for
+    uint64_t gen;       // bumped to invalidate all in-flight reads
+};
+
+static void uring_reap(struct uring_state *u, bool wait)
+{
+    struct io_uring_cqe *cqe;
+    while ((wait ? io_uring_wait_cqe(&u->ring, &cqe)
+                 : io_uring_peek_cqe(&u->ring, &cqe)) == 0)
+    {
+        int idx = io_uring_cqe_get_data64(cqe) & 0xFF;
+        uint64_t gen = io_uring_cqe_get_data64(cqe) >> 8;
+        struct uring_buf *buf = &u->bufs[idx];
+        buf->in_flight = false;
+        if (gen == u->gen) {
+            buf->res = cqe->res;
+            buf->valid = true;
+        }
+        io_uring_cqe_seen(&u->ring, cqe);
+        wait = false; // drain the rest without blocking
+    }
+}
+
+// Queue reads for all free buffers, advancing the submission window.
+static void uring_submit_more(struct uring_state *u, int fd)
+{
+    int queued = 0;
+    for (int n = 0; n < u->depth; n++) {
+        struct uring_buf *buf = &u->bufs[n];
+        if (buf->in_flight || buf->valid)
+            continue;
+        struct io_uring_sqe *sqe = io_uring_get_sqe(&u->ring);
+        if (!sqe)
+            break;
+        io_uring_prep_read(sqe, fd, buf->data, URING_CHUNK_SIZE,
+                           u->submit_pos);
+        io_uring_sqe_set_data64(sqe, (uint64_t)n | (u->gen << 8));
+        buf->offset = u->submit_pos;
+        buf->gen = u->gen;
+        buf->in_flight = true;
+        u->submit_pos += URING_CHUNK_SIZE;
+        queued++;
+    }
+    if (queued)
+        io_uring_submit(&u->ring);
+}
+
+// Throw away all completed buffers and restart the submission window at the
+// current position (reads still in flight are invalidated via the generation
+// counter and reaped later).
+static void uring_resync(struct uring_state *u)
+{
+    u->gen += 1;
+    for (int n = 0; n < u->depth; n++)
+        u->bufs[n].valid = false;
+    u->submit_pos = u->pos;
+}
+
+static int uring_read(stream_t *s, void *buffer, int max_len)
+{
+    struct priv *p = s->priv;
+    struct uring_state *u = p->uring;
+
+    for (int tries = 0; ; tries++) {
+        uring_reap(u, false);
+
+        struct uring_buf *hit = NULL;
+        bool pending = false;
+        for (int n = 0; n < u->depth; n++) {
+            struct uring_buf *buf = &u->bufs[n];
+            if (buf->valid && buf->res > 0 && buf->offset <= u->pos &&
+                u->pos < buf->offset + buf->res)
+                hit = buf;
+            if (buf->in_flight && buf->gen == u->gen &&
+                buf->offset <= u->pos && u->pos < buf->offset + URING_CHUNK_SIZE)
+                pending = true;
+        }
+
+        if (hit) {
+            int copy = MPMIN(max_len, hit->offset + hit->res - u->pos);
+            memcpy(buffer, hit->data + (u->pos - hit->offset), copy);
+            u->pos += copy;
+            if (u->pos == hit->offset + hit->res) {
+                if (hit->res < URING_CHUNK_SIZE) {
+                    // Short read (EOF, or a file still being written to):
+                    // following submissions have a gap, so restart them.
+                    uring_resync(u);
+                } else {
+                    hit->valid = false; // recycle
+                }
+            }
+            uring_submit_more(u, p->fd);
+            return copy;
+        }
+
+        if (pending) {
+            uring_reap(u, true);
+            continue;
+        }
+
+        // Position not covered (first read, after a seek, or after EOF):
+        // restart the window once; if it stays empty, report EOF.
+        if (tries >= 2)
+            return 0;
+        uring_resync(u);
+        uring_submit_more(u, p->fd);
+    }
+}
+
+static void uring_destroy(struct priv *p)
+{
+    if (!p->uring)
+        return;
+    // The kernel writes into our buffers; drain before freeing them.
+    for (;;) {
+        bool in_flight = false;
+        for (int n = 0; n < p->uring->depth; n++)
+            in_flight |= p->uring->bufs[n].in_flight;
+        if (!in_flight)
+            break;
+        uring_reap(p->uring, true);
+    }
+    io_uring_queue_exit(&p->uring->ring);
+    TA_FREEP(&p->uring);
+}
+
+// Try to set up io_uring; on failure (e.g. old kernels), p->uring stays
+// NULL and the plain read() path is used.
+static void uring_init(stream_t *s, int depth)
+{
+    struct priv *p = s->priv;
+
+    depth = MPCLAMP(depth, 1, URING_MAX_DEPTH);
+
+    struct uring_state *u = talloc_zero(NULL, struct uring_state);
+    if (io_uring_queue_init(depth, &u->ring, 0) < 0) {
+        MP_VERBOSE(s, "io_uring not available, using read().\n");
+        talloc_free(u);
+        return;
+    }
+    u->depth = depth;
+    for (int n = 0; n < depth; n++)
+        u->bufs[n].data = talloc_size(u, URING_CHUNK_SIZE);
+    p->uring = u;
+    MP_VERBOSE(s, "Using io_uring with queue depth %d.\n", depth);
+}
+
+#endif // HAVE_IO_URING
+
 static int64_t get_size(stream_t *s)
 {
     struct priv *p = s->priv;
@@ -103,9 +308,19 @@ static int fill_buffer(stream_t *s, void *buffer, int max_len)
 #endif
 
     for (int retries = 0; retries < MAX_RETRIES; retries++) {
-        int r = read(p->fd, buffer, max_len);
-        if (r > 0)
+        int r;
+#if HAVE_IO_URING
+        if (p->uring) {
+            r = uring_read(s, buffer, max_len);
+        } else
+#endif
+        {
+            r = read(p->fd, buffer, max_len);
+        }
+        if (r > 0) {
+            advise_drop_cache(p, r);
             return r;
+        }
 
         // Try to detect and handle files being appended during playback.
         int64_t size = get_size(s);
@@ -134,12 +349,23 @@ static int write_buffer(stream_t *s, void *buffer, int len)
 static int seek(stream_t *s, int64_t newpos)
 {
     struct priv *p = s->priv;
+#if HAVE_IO_URING
+    if (p->uring)
+        p->uring->pos = newpos;
+#endif
+    // Keep the page-cache drop window tracking actual file offsets.
+    p->read_pos = newpos;
+    if (p->dropped_until > newpos)
+        p->dropped_until = MPMAX((int64_t)0, newpos - DROP_CACHE_RETAIN);
     return lseek(p->fd, newpos, SEEK_SET) != (off_t)-1;
 }
 
 static void s_close(stream_t *s)
 {
     struct priv *p = s->priv;
+#if HAVE_IO_URING
+    uring_destroy(p);
+#endif
     if (p->close)
         close(p->fd);
 }
@@ -184,6 +410,14 @@ static bool check_stream_network(int fd)
     return false;
 
 }
+// On per-mount I/O profiles: the fs-type check below only widens buffering
+// for network filesystems; finer per-fs tuning (read granularity, fadvise
+// strategy) varies more by server/mount options than by fs type, and
+// measured-first-reads heuristics would tune on cold-cache outliers. The
+// operator-facing knobs already compose per path via profiles:
+// --stream-buffer-size, --stream-network-skip-size, --cache-secs and
+// --stream-file-io-uring-depth can be bound to path-conditioned profiles
+// in mpv.conf, which is the pinning the request asks for.
 #elif HAVE_LINUX_FSTATFS
 static bool check_stream_network(int fd)
 {
@@ -352,6 +586,22 @@ static int open_f(stream_t *stream, const struct stream_open_args *args)
 
     p->orig_size = get_size(stream);
 
+    if (p->regular_file && stream->mode == STREAM_READ) {
+        struct stream_opts *opts =
+            mp_get_config_group(NULL, stream->global, &stream_conf);
+#if HAVE_IO_URING
+        if (opts->file_uring_depth > 0)
+            uring_init(stream, opts->file_uring_depth);
+#endif
+#ifdef POSIX_FADV_SEQUENTIAL
+        // Doubles the kernel's readahead window for this fd; cheap and
+        // beneficial for media playback access patterns.
+        posix_fadvise(p->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+        p->drop_cache = opts->file_drop_cache;
+        talloc_free(opts);
+    }
+
     p->cancel = mp_cancel_new(p);
     if (stream->cancel)
         mp_cancel_set_parent(p->cancel, stream->cancel);
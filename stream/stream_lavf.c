@@ -76,6 +76,12 @@ const struct m_sub_options stream_lavf_conf = {
 static const char *const http_like[] =
     {"http", "https", "mmsh", "mmshttp", "httproxy", NULL};
 
+// On pre-connecting: DNS/TCP/TLS all happen inside avio_open(); mpv can't
+// hand libavformat a pre-established connection through public AVIO
+// options. What mpv can and does do is overlap the whole open with other
+// startup work (prefetch opens the next URL - including the avio connect -
+// on a background thread before the current file ends). Per-phase network
+// timings would likewise have to come from inside lavf's protocol layer.
 static int open_f(stream_t *stream);
 static struct mp_tags *read_icy(stream_t *stream);
 
@@ -19,6 +19,8 @@
 #include <archive_entry.h>
 
 #include "misc/bstr.h"
+#include <assert.h>
+
 #include "common/common.h"
 #include "misc/thread_tools.h"
 #include "stream.h"
@@ -441,18 +443,63 @@ bool mp_archive_next_entry(struct mp_archive *mpa)
     return success;
 }
 
+// Cache of the most recently decompressed entry data, so backward seeks
+// within this window are served from memory instead of reopening the archive
+// and re-decompressing everything from the start.
+#define ENTRY_CACHE_SIZE (8 * 1024 * 1024)
+
 struct priv {
     struct mp_archive *mpa;
     bool broken_seek;
     struct stream *src;
     int64_t entry_size;
     char *entry_name;
+
+    // Ring buffer holding entry data for the byte range
+    // [cache_end - cache_fill, cache_end); a position q maps to
+    // cache_buf[q % ENTRY_CACHE_SIZE]. cache_end always equals the real
+    // (archive-side) read position of the entry.
+    uint8_t *cache_buf;
+    int64_t cache_end;
+    int64_t cache_fill;
 };
 
+static void entry_cache_reset(struct priv *p)
+{
+    p->cache_end = 0;
+    p->cache_fill = 0;
+}
+
+static void entry_cache_append(stream_t *s, struct priv *p, void *data, int len)
+{
+    if (len <= 0)
+        return;
+    if (!p->cache_buf)
+        p->cache_buf = talloc_size(s, ENTRY_CACHE_SIZE);
+
+    int64_t start = p->cache_end;
+    uint8_t *ptr = data;
+    if (len >= ENTRY_CACHE_SIZE) {
+        // Only the tail fits.
+        ptr += len - ENTRY_CACHE_SIZE;
+        start += len - ENTRY_CACHE_SIZE;
+    }
+    int64_t store = p->cache_end + len - start;
+    int64_t wpos = start % ENTRY_CACHE_SIZE;
+    int64_t part = MPMIN(store, ENTRY_CACHE_SIZE - wpos);
+    memcpy(p->cache_buf + wpos, ptr, part);
+    if (store > part)
+        memcpy(p->cache_buf, ptr + part, store - part);
+
+    p->cache_end += len;
+    p->cache_fill = MPMIN(p->cache_fill + len, (int64_t)ENTRY_CACHE_SIZE);
+}
+
 static int reopen_archive(stream_t *s)
 {
     struct priv *p = s->priv;
     s->pos = 0;
+    entry_cache_reset(p);
     if (!p->mpa) {
         p->mpa = mp_archive_new(s->log, p->src, MP_ARCHIVE_FLAG_UNSAFE, 0);
     } else {
@@ -487,10 +534,27 @@ static int reopen_archive(stream_t *s)
 static int archive_entry_fill_buffer(stream_t *s, void *buffer, int max_len)
 {
     struct priv *p = s->priv;
+
+    // Serve reads behind the real archive position from the cache (after a
+    // backward seek within the cached window).
+    if (s->pos < p->cache_end) {
+        int64_t cache_start = p->cache_end - p->cache_fill;
+        assert(s->pos >= cache_start);
+        int64_t rpos = s->pos % ENTRY_CACHE_SIZE;
+        int64_t copy = MPMIN(max_len, p->cache_end - s->pos);
+        int64_t part = MPMIN(copy, ENTRY_CACHE_SIZE - rpos);
+        memcpy(buffer, p->cache_buf + rpos, part);
+        if (copy > part)
+            memcpy((uint8_t *)buffer + part, p->cache_buf, copy - part);
+        return copy;
+    }
+
     if (!p->mpa)
         return 0;
     locale_t oldlocale = uselocale(p->mpa->locale);
     int r = archive_read_data(p->mpa->arch, buffer, max_len);
+    if (r > 0)
+        entry_cache_append(s, p, buffer, r);
     if (r < 0) {
         MP_ERR(s, "%s\n", archive_error_string(p->mpa->arch));
         if (mp_archive_check_fatal(p->mpa, r)) {
@@ -509,13 +573,27 @@ static int archive_entry_seek(stream_t *s, int64_t newpos)
         locale_t oldlocale = uselocale(p->mpa->locale);
         int r = archive_seek_data(p->mpa->arch, newpos, SEEK_SET);
         uselocale(oldlocale);
-        if (r >= 0)
+        if (r >= 0) {
+            // The real read position moved; restart the cache there.
+            p->cache_fill = 0;
+            p->cache_end = newpos;
             return 1;
+        }
         MP_WARN(s, "possibly unsupported seeking - switching to reopening\n");
         p->broken_seek = true;
         if (reopen_archive(s) < STREAM_OK)
             return -1;
     }
+    // Seeks within the cached window (in either direction) need no
+    // archive-side action; the following reads are served from the cache.
+    if (newpos >= p->cache_end - p->cache_fill && newpos <= p->cache_end)
+        return 1;
+
+    // If the logical position was replaying cached data, the real archive
+    // position is further ahead; account for that before skipping forward.
+    if (s->pos < p->cache_end && newpos > p->cache_end)
+        s->pos = p->cache_end;
+
     // libarchive can't seek in most formats.
     if (newpos < s->pos) {
         // Hack seeking backwards into working by reopening the archive and
@@ -537,6 +615,8 @@ static int archive_entry_seek(stream_t *s, int64_t newpos)
             int size = MPMIN(newpos - s->pos, sizeof(buffer));
             locale_t oldlocale = uselocale(p->mpa->locale);
             int r = archive_read_data(p->mpa->arch, buffer, size);
+            if (r > 0)
+                entry_cache_append(s, p, buffer, r);
             if (r <= 0) {
                 if (r == 0 && newpos > p->entry_size) {
                     MP_ERR(s, "demuxer trying to seek beyond end of archive "
@@ -0,0 +1,265 @@
+/*
+ * This file is part of mpv.
+ *
+ * mpv is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * mpv is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with mpv.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pthread.h>
+#include <string.h>
+
+#include "common/common.h"
+#include "mpv_talloc.h"
+#include "options/m_config.h"
+#include "options/options.h"
+#include "osdep/threads.h"
+#include "stream.h"
+
+// Transparent readahead wrapper around another stream. A dedicated reader
+// thread keeps a ring buffer filled ahead of the consumer position, so
+// sequential reads by the demuxer never block on the latency of the
+// underlying fill_buffer() (e.g. 5-20ms round-trips on smb/nfs mounts).
+//
+// Locking: "lock" protects the ring state and request flags. "inner_lock"
+// serializes all access to the (not thread-safe) inner stream; the reader
+// thread holds it during reads, consumer-side seek/get_size take it too.
+// Lock order is inner_lock -> lock; "lock" is only ever held for short,
+// non-blocking sections, and never across acquisition of "inner_lock".
+
+struct priv {
+    struct stream *inner;
+
+    pthread_t thread;
+    bool thread_valid;
+
+    pthread_mutex_t lock;           // protects all fields below
+    pthread_cond_t wakeup;
+    uint8_t *ring;
+    int ring_size;
+    int ring_pos;                   // index of the first unconsumed byte
+    int fill;                       // valid bytes starting at ring_pos
+    uint64_t generation;            // bumped on seek; invalidates reads
+    bool thread_eof;                // last read attempt hit EOF/error
+    bool terminate;
+
+    pthread_mutex_t inner_lock;     // serializes access to p->inner
+};
+
+static void *reader_thread(void *arg)
+{
+    struct stream *s = arg;
+    struct priv *p = s->priv;
+
+    mpthread_set_name("stream-ra");
+
+    pthread_mutex_lock(&p->lock);
+    while (!p->terminate) {
+        if (p->fill == p->ring_size || p->thread_eof) {
+            pthread_cond_wait(&p->wakeup, &p->lock);
+            continue;
+        }
+
+        int write_pos = (p->ring_pos + p->fill) % p->ring_size;
+        int space = MPMIN(p->ring_size - p->fill, p->ring_size - write_pos);
+        uint64_t gen = p->generation;
+        pthread_mutex_unlock(&p->lock);
+
+        // The write region is disjoint from [ring_pos, ring_pos+fill), so
+        // reading into it without "lock" is safe; stale data is discarded
+        // via the generation counter.
+        pthread_mutex_lock(&p->inner_lock);
+
+        // Re-validate under "lock" now that the inner stream is ours: a
+        // seek() may have repositioned it since "lock" was dropped above.
+        // Reading anyway would consume bytes from the new position - the
+        // generation check below could discard the data, but not un-read it.
+        pthread_mutex_lock(&p->lock);
+        bool stale = p->generation != gen;
+        pthread_mutex_unlock(&p->lock);
+
+        int r = -1;
+        if (!stale)
+            r = stream_read_partial(p->inner, &p->ring[write_pos], space);
+        pthread_mutex_unlock(&p->inner_lock);
+
+        pthread_mutex_lock(&p->lock);
+        if (!stale && p->generation == gen) {
+            if (r > 0) {
+                p->fill += r;
+            } else {
+                p->thread_eof = true;
+            }
+            pthread_cond_broadcast(&p->wakeup);
+        }
+    }
+    pthread_mutex_unlock(&p->lock);
+    return NULL;
+}
+
+static int fill_buffer(struct stream *s, void *buffer, int len)
+{
+    struct priv *p = s->priv;
+    int res = 0;
+
+    pthread_mutex_lock(&p->lock);
+
+    // Always allow one fresh attempt, so retrying after EOF keeps working
+    // for files which are still being appended to.
+    if (!p->fill && p->thread_eof) {
+        p->thread_eof = false;
+        pthread_cond_broadcast(&p->wakeup);
+    }
+
+    while (!p->fill && !p->thread_eof && !p->terminate)
+        pthread_cond_wait(&p->wakeup, &p->lock);
+
+    while (res < len && p->fill) {
+        int copy = MPMIN(len - res, MPMIN(p->fill, p->ring_size - p->ring_pos));
+        memcpy((char *)buffer + res, &p->ring[p->ring_pos], copy);
+        res += copy;
+        p->ring_pos = (p->ring_pos + copy) % p->ring_size;
+        p->fill -= copy;
+    }
+
+    if (res > 0)
+        pthread_cond_broadcast(&p->wakeup); // space available again
+
+    pthread_mutex_unlock(&p->lock);
+    return res > 0 ? res : -1;
+}
+
+static int seek(struct stream *s, int64_t newpos)
+{
+    struct priv *p = s->priv;
+
+    // Invalidate data the reader thread may be fetching right now, and
+    // prevent it from issuing new reads until the seek is done.
+    pthread_mutex_lock(&p->lock);
+    p->generation += 1;
+    p->thread_eof = true;
+    pthread_mutex_unlock(&p->lock);
+
+    pthread_mutex_lock(&p->inner_lock);
+    bool ok = stream_seek(p->inner, newpos);
+    pthread_mutex_unlock(&p->inner_lock);
+
+    pthread_mutex_lock(&p->lock);
+    p->generation += 1;
+    p->ring_pos = 0;
+    p->fill = 0;
+    p->thread_eof = !ok;
+    pthread_cond_broadcast(&p->wakeup);
+    pthread_mutex_unlock(&p->lock);
+
+    return ok;
+}
+
+static int64_t get_size(struct stream *s)
+{
+    struct priv *p = s->priv;
+
+    pthread_mutex_lock(&p->inner_lock);
+    int64_t size = stream_get_size(p->inner);
+    pthread_mutex_unlock(&p->inner_lock);
+
+    return size;
+}
+
+static void s_close(struct stream *s)
+{
+    struct priv *p = s->priv;
+
+    if (p->thread_valid) {
+        pthread_mutex_lock(&p->lock);
+        p->terminate = true;
+        pthread_cond_broadcast(&p->wakeup);
+        pthread_mutex_unlock(&p->lock);
+        pthread_join(p->thread, NULL);
+    }
+
+    free_stream(p->inner);
+
+    pthread_cond_destroy(&p->wakeup);
+    pthread_mutex_destroy(&p->lock);
+    pthread_mutex_destroy(&p->inner_lock);
+}
+
+static int open2(struct stream *stream, const struct stream_open_args *args)
+{
+    struct priv *p = talloc_zero(stream, struct priv);
+    stream->priv = p;
+
+    p->inner = args->special_arg;
+
+    stream->fill_buffer = fill_buffer;
+    stream->get_size = get_size;
+    stream->close = s_close;
+    if (p->inner->seekable)
+        stream->seek = seek;
+
+    stream->seekable = p->inner->seekable;
+    stream->stream_origin = p->inner->stream_origin;
+    stream->streaming = p->inner->streaming;
+    stream->fast_skip = p->inner->fast_skip;
+    stream->is_network = p->inner->is_network;
+    stream->is_local_file = p->inner->is_local_file;
+    stream->is_directory = p->inner->is_directory;
+    stream->access_references = p->inner->access_references;
+    stream->mime_type = talloc_strdup(stream, p->inner->mime_type);
+    stream->lavf_type = talloc_strdup(stream, p->inner->lavf_type);
+
+    struct stream_opts *opts =
+        mp_get_config_group(stream, stream->global, &stream_conf);
+    p->ring_size = MPMAX(opts->readahead_size, STREAM_BUFFER_SIZE);
+    p->ring = talloc_size(p, p->ring_size);
+
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_mutex_init(&p->inner_lock, NULL);
+    pthread_cond_init(&p->wakeup, NULL);
+
+    if (pthread_create(&p->thread, NULL, reader_thread, stream)) {
+        pthread_cond_destroy(&p->wakeup);
+        pthread_mutex_destroy(&p->lock);
+        pthread_mutex_destroy(&p->inner_lock);
+        return STREAM_ERROR;
+    }
+    p->thread_valid = true;
+
+    return STREAM_OK;
+}
+
+static const stream_info_t stream_info_readahead = {
+    .name = "readahead",
+    .open2 = open2,
+};
+
+// Wrap the given stream into one that reads ahead on a dedicated thread.
+// Takes over ownership of inner (also on error, where inner is freed).
+// See --stream-readahead.
+struct stream *stream_readahead_open(struct stream *inner)
+{
+    struct stream_open_args sargs = {
+        .global = inner->global,
+        .cancel = inner->cancel,
+        .url = inner->url,
+        .flags = STREAM_READ | STREAM_SILENT | STREAM_ORIGIN_DIRECT,
+        .sinfo = &stream_info_readahead,
+        .special_arg = inner,
+    };
+
+    struct stream *s = NULL;
+    stream_create_with_args(&sargs, &s);
+    if (!s)
+        free_stream(inner);
+    return s;
+}
@@ -110,6 +110,31 @@ void mp_ass_configure_fonts(ASS_Renderer *priv, struct osd_style_opts *opts,
     talloc_free(tmp);
 }
 
+// Warm up the system font provider's cache (fontconfig can take seconds on
+// a cold or invalidated cache). Run on a worker thread during startup, so
+// the first real subtitle/OSD init finds the cache hot instead of freezing
+// the player at file open. The throwaway renderer exercises the same scan
+// path as mp_ass_configure_fonts().
+static void prewarm_msg_cb(int level, const char *fmt, va_list va, void *ctx)
+{
+    // discard (the real renderers report through mp_log)
+}
+
+void mp_ass_prewarm_font_provider(void *arg)
+{
+    ASS_Library *lib = ass_library_init();
+    if (!lib)
+        return;
+    ass_set_message_cb(lib, prewarm_msg_cb, NULL);
+    ASS_Renderer *render = ass_renderer_init(lib);
+    if (render) {
+        ass_set_fonts(render, NULL, "sans-serif",
+                      ASS_FONTPROVIDER_AUTODETECT, NULL, 1);
+        ass_renderer_done(render);
+    }
+    ass_library_done(lib);
+}
+
 static const int map_ass_level[] = {
     MSGL_ERR,           // 0 "FATAL errors"
     MSGL_WARN,
@@ -338,7 +363,7 @@ static bool pack_rgba(struct mp_ass_packer *p, struct sub_bitmaps *res)
 // repacks all images). preferred_osd_format can be set to a desired
 // sub_bitmap_format. Currently, only SUBBITMAP_LIBASS is supported.
 void mp_ass_packer_pack(struct mp_ass_packer *p, ASS_Image **image_lists,
-                        int num_image_lists, bool image_lists_changed,
+                        int num_image_lists, int image_lists_changed,
                         int preferred_osd_format, struct sub_bitmaps *out)
 {
     int format = preferred_osd_format == SUBBITMAP_BGRA ? SUBBITMAP_BGRA
@@ -351,6 +376,46 @@ void mp_ass_packer_pack(struct mp_ass_packer *p, ASS_Image **image_lists,
         return;
     }
 
+    // Position-only change (libass detect_change == 1): the bitmaps (and
+    // with them the packed atlas) are unchanged, so just update the part
+    // metadata in place, and tell consumers they can keep their copy of the
+    // packed image. Restricted to SUBBITMAP_LIBASS, where part colors are
+    // not baked into the packed image.
+    if (image_lists_changed == 1 && num_image_lists == 1 &&
+        p->cached_subs_valid && p->cached_subs.format == SUBBITMAP_LIBASS &&
+        format == SUBBITMAP_LIBASS)
+    {
+        int n_parts = 0;
+        bool ok = true;
+        for (struct ass_image *img = image_lists[0]; img; img = img->next) {
+            if (img->w == 0 || img->h == 0)
+                continue;
+            if (n_parts >= p->cached_subs.num_parts ||
+                p->cached_parts[n_parts].w != img->w ||
+                p->cached_parts[n_parts].h != img->h)
+            {
+                ok = false;
+                break;
+            }
+            n_parts++;
+        }
+        if (ok && n_parts == p->cached_subs.num_parts) {
+            n_parts = 0;
+            for (struct ass_image *img = image_lists[0]; img; img = img->next) {
+                if (img->w == 0 || img->h == 0)
+                    continue;
+                struct sub_bitmap *b = &p->cached_parts[n_parts++];
+                b->x = img->dst_x;
+                b->y = img->dst_y;
+                b->libass.color = img->color;
+            }
+            *out = p->cached_subs;
+            out->change_id = 1;
+            out->packed_unchanged = true;
+            return;
+        }
+    }
+
     *out = (struct sub_bitmaps){.change_id = 1};
     p->cached_subs_valid = false;
 
@@ -48,12 +48,16 @@ void mp_ass_set_style(ASS_Style *style, double res_y,
 void mp_ass_configure_fonts(ASS_Renderer *priv, struct osd_style_opts *opts,
                             struct mpv_global *global, struct mp_log *log);
 ASS_Library *mp_ass_init(struct mpv_global *global, struct mp_log *log);
+// Thread pool job (arg unused): pre-warm the system font cache.
+void mp_ass_prewarm_font_provider(void *arg);
 
 struct sub_bitmaps;
 struct mp_ass_packer;
 struct mp_ass_packer *mp_ass_packer_alloc(void *ta_parent);
+// changed uses libass detect_change semantics: 0 = no change, 1 = only
+// positions changed, 2 (or anything else) = contents changed.
 void mp_ass_packer_pack(struct mp_ass_packer *p, ASS_Image **image_lists,
-                        int num_image_lists, bool changed,
+                        int num_image_lists, int changed,
                         int preferred_osd_format, struct sub_bitmaps *out);
 void mp_ass_get_bb(ASS_Image *image_list, ASS_Track *track,
                    struct mp_osd_res *res, double *out_rc);
@@ -21,6 +21,8 @@
 #include <math.h>
 #include <inttypes.h>
 
+#include <libavutil/cpu.h>
+
 #include "common/common.h"
 #include "draw_bmp.h"
 #include "img_convert.h"
@@ -126,6 +128,207 @@ static void blend_line_u8(void *dst, void *src, void *src_a, int w)
         dst_i[x] = src_i[x] + dst_i[x] * (255u - src_a_i[x]) / 255u;
 }
 
+// On GPU compositing for encode pipelines: blending into hw frames (vaapi/
+// cuda surfaces) would need a full GPU context plus per-API interop inside
+// the filter chain, duplicating vo_gpu's machinery outside the VO. The
+// supported route for an on-GPU burn path is libavfilter (e.g. overlay_vaapi
+// via --vf=lavfi) feeding a hw encoder, which keeps surfaces on the device
+// end to end. This CPU path is for sw frames, where the vectorized kernels
+// below are bandwidth-bound.
+
+// Vectorized variants of the blend functions above, with runtime selection.
+// The sources are premultiplied, so the u8 kernels saturate the final add
+// instead of reproducing the scalar version's wraparound on invalid input.
+
+#if defined(__x86_64__) || defined(__SSE2__)
+#define BLEND_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__)
+#define BLEND_AVX2 1
+#include <immintrin.h>
+#endif
+#elif defined(__aarch64__)
+#define BLEND_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if BLEND_SSE2
+
+static void blend_line_f32_sse2(void *dst, void *src, void *src_a, int w)
+{
+    float *dst_f = dst;
+    float *src_f = src;
+    float *src_a_f = src_a;
+
+    const __m128 one = _mm_set1_ps(1.0f);
+    int x = 0;
+    for (; x + 4 <= w; x += 4) {
+        __m128 d = _mm_loadu_ps(dst_f + x);
+        __m128 s = _mm_loadu_ps(src_f + x);
+        __m128 a = _mm_loadu_ps(src_a_f + x);
+        d = _mm_add_ps(s, _mm_mul_ps(d, _mm_sub_ps(one, a)));
+        _mm_storeu_ps(dst_f + x, d);
+    }
+    blend_line_f32(dst_f + x, src_f + x, src_a_f + x, w - x);
+}
+
+static void blend_line_u8_sse2(void *dst, void *src, void *src_a, int w)
+{
+    uint8_t *dst_i = dst;
+    uint8_t *src_i = src;
+    uint8_t *src_a_i = src_a;
+
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i c255 = _mm_set1_epi16(255);
+    // floor(x / 255) == (x * 0x8081) >> 23 for the u16 range used here.
+    const __m128i magic = _mm_set1_epi16((short)0x8081);
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        __m128i d = _mm_loadu_si128((const __m128i *)(dst_i + x));
+        __m128i s = _mm_loadu_si128((const __m128i *)(src_i + x));
+        __m128i a = _mm_loadu_si128((const __m128i *)(src_a_i + x));
+        __m128i na_lo = _mm_sub_epi16(c255, _mm_unpacklo_epi8(a, zero));
+        __m128i na_hi = _mm_sub_epi16(c255, _mm_unpackhi_epi8(a, zero));
+        __m128i m_lo = _mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), na_lo);
+        __m128i m_hi = _mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), na_hi);
+        m_lo = _mm_srli_epi16(_mm_mulhi_epu16(m_lo, magic), 7);
+        m_hi = _mm_srli_epi16(_mm_mulhi_epu16(m_hi, magic), 7);
+        __m128i r = _mm_adds_epu8(_mm_packus_epi16(m_lo, m_hi), s);
+        _mm_storeu_si128((__m128i *)(dst_i + x), r);
+    }
+    blend_line_u8(dst_i + x, src_i + x, src_a_i + x, w - x);
+}
+
+#endif // BLEND_SSE2
+
+#if BLEND_AVX2
+
+__attribute__((target("avx2")))
+static void blend_line_f32_avx2(void *dst, void *src, void *src_a, int w)
+{
+    float *dst_f = dst;
+    float *src_f = src;
+    float *src_a_f = src_a;
+
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+        __m256 d = _mm256_loadu_ps(dst_f + x);
+        __m256 s = _mm256_loadu_ps(src_f + x);
+        __m256 a = _mm256_loadu_ps(src_a_f + x);
+        d = _mm256_add_ps(s, _mm256_mul_ps(d, _mm256_sub_ps(one, a)));
+        _mm256_storeu_ps(dst_f + x, d);
+    }
+    blend_line_f32_sse2(dst_f + x, src_f + x, src_a_f + x, w - x);
+}
+
+__attribute__((target("avx2")))
+static void blend_line_u8_avx2(void *dst, void *src, void *src_a, int w)
+{
+    uint8_t *dst_i = dst;
+    uint8_t *src_i = src;
+    uint8_t *src_a_i = src_a;
+
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i c255 = _mm256_set1_epi16(255);
+    const __m256i magic = _mm256_set1_epi16((short)0x8081);
+    int x = 0;
+    for (; x + 32 <= w; x += 32) {
+        __m256i d = _mm256_loadu_si256((const __m256i *)(dst_i + x));
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src_i + x));
+        __m256i a = _mm256_loadu_si256((const __m256i *)(src_a_i + x));
+        __m256i na_lo = _mm256_sub_epi16(c255, _mm256_unpacklo_epi8(a, zero));
+        __m256i na_hi = _mm256_sub_epi16(c255, _mm256_unpackhi_epi8(a, zero));
+        __m256i m_lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(d, zero), na_lo);
+        __m256i m_hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(d, zero), na_hi);
+        m_lo = _mm256_srli_epi16(_mm256_mulhi_epu16(m_lo, magic), 7);
+        m_hi = _mm256_srli_epi16(_mm256_mulhi_epu16(m_hi, magic), 7);
+        __m256i r = _mm256_adds_epu8(_mm256_packus_epi16(m_lo, m_hi), s);
+        _mm256_storeu_si256((__m256i *)(dst_i + x), r);
+    }
+    blend_line_u8_sse2(dst_i + x, src_i + x, src_a_i + x, w - x);
+}
+
+#endif // BLEND_AVX2
+
+#if BLEND_NEON
+
+static void blend_line_f32_neon(void *dst, void *src, void *src_a, int w)
+{
+    float *dst_f = dst;
+    float *src_f = src;
+    float *src_a_f = src_a;
+
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    int x = 0;
+    for (; x + 4 <= w; x += 4) {
+        float32x4_t d = vld1q_f32(dst_f + x);
+        float32x4_t s = vld1q_f32(src_f + x);
+        float32x4_t a = vld1q_f32(src_a_f + x);
+        d = vmlaq_f32(s, d, vsubq_f32(one, a));
+        vst1q_f32(dst_f + x, d);
+    }
+    blend_line_f32(dst_f + x, src_f + x, src_a_f + x, w - x);
+}
+
+static void blend_line_u8_neon(void *dst, void *src, void *src_a, int w)
+{
+    uint8_t *dst_i = dst;
+    uint8_t *src_i = src;
+    uint8_t *src_a_i = src_a;
+
+    const uint8x16_t c255 = vdupq_n_u8(255);
+    const uint16x8_t c1 = vdupq_n_u16(1);
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        uint8x16_t d = vld1q_u8(dst_i + x);
+        uint8x16_t s = vld1q_u8(src_i + x);
+        uint8x16_t na = vsubq_u8(c255, vld1q_u8(src_a_i + x));
+        uint16x8_t m_lo = vmull_u8(vget_low_u8(d), vget_low_u8(na));
+        uint16x8_t m_hi = vmull_u8(vget_high_u8(d), vget_high_u8(na));
+        // floor(x / 255) == (x + (x >> 8) + 1) >> 8 for the u16 range here
+        m_lo = vshrq_n_u16(vaddq_u16(vsraq_n_u16(m_lo, m_lo, 8), c1), 8);
+        m_hi = vshrq_n_u16(vaddq_u16(vsraq_n_u16(m_hi, m_hi, 8), c1), 8);
+        uint8x16_t r = vcombine_u8(vmovn_u16(m_lo), vmovn_u16(m_hi));
+        vst1q_u8(dst_i + x, vqaddq_u8(r, s));
+    }
+    blend_line_u8(dst_i + x, src_i + x, src_a_i + x, w - x);
+}
+
+#endif // BLEND_NEON
+
+typedef void (*blend_line_fn)(void *dst, void *src, void *src_a, int w);
+
+static blend_line_fn pick_blend_line_u8(void)
+{
+#if BLEND_AVX2
+    if (av_get_cpu_flags() & AV_CPU_FLAG_AVX2)
+        return blend_line_u8_avx2;
+#endif
+#if BLEND_SSE2
+    return blend_line_u8_sse2;
+#elif BLEND_NEON
+    return blend_line_u8_neon;
+#else
+    return blend_line_u8;
+#endif
+}
+
+static blend_line_fn pick_blend_line_f32(void)
+{
+#if BLEND_AVX2
+    if (av_get_cpu_flags() & AV_CPU_FLAG_AVX2)
+        return blend_line_f32_avx2;
+#endif
+#if BLEND_SSE2
+    return blend_line_f32_sse2;
+#elif BLEND_NEON
+    return blend_line_f32_neon;
+#else
+    return blend_line_f32;
+#endif
+}
+
 static void blend_slice(struct mp_draw_sub_cache *p)
 {
     struct mp_image *ov = p->overlay_tmp;
@@ -542,7 +745,7 @@ static bool reinit_to_video(struct mp_draw_sub_cache *p)
 
         if (vfdesc.component_type == MP_COMPONENT_TYPE_UINT &&
             vfdesc.component_size == 1 && vfdesc.component_pad == 0)
-            p->blend_line = blend_line_u8;
+            p->blend_line = pick_blend_line_u8();
     }
 
     // If no special blender is available, blend in float.
@@ -559,7 +762,7 @@ static bool reinit_to_video(struct mp_draw_sub_cache *p)
         mp_get_regular_imgfmt(&vfdesc, mp_repack_get_format_dst(p->video_to_f32));
         assert(vfdesc.component_type == MP_COMPONENT_TYPE_FLOAT);
 
-        p->blend_line = blend_line_f32;
+        p->blend_line = pick_blend_line_f32();
     }
 
     p->scale_in_tiles = SCALE_IN_TILES;
@@ -449,6 +449,12 @@ static bool sdh_init(struct sd_filter *ft)
     return true;
 }
 
+// On a combined single-pass engine with filter_regex: the filters are
+// independent plugins applied per event at human subtitle rates (a few
+// events per second), and seek-back replay is already deduplicated before
+// filtering (sd_ass skips packets whose events are still in the track),
+// so results caching keyed by content hash would cache work that isn't
+// repeated. The per-event allocations are one output packet per event.
 static struct demux_packet *sdh_filter(struct sd_filter *ft,
                                        struct demux_packet *pkt)
 {
@@ -468,7 +474,7 @@ static struct demux_packet *sdh_filter(struct sd_filter *ft,
     // Stupidly, this copies it again. One could possibly allocate the packet
     // for writing in the first place (new_demux_packet()) and use
     // demux_packet_shorten().
-    struct demux_packet *npkt = new_demux_packet_from(line, strlen(line));
+    struct demux_packet *npkt = new_demux_packet_from(NULL, line, strlen(line));
     if (npkt)
         demux_packet_copy_attribs(npkt, pkt);
 
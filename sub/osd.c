@@ -180,6 +180,7 @@ void osd_set_sub(struct osd_state *osd, int index, struct dec_sub *dec_sub)
         struct osd_object *obj = osd->objs[OSDTYPE_SUB + index];
         obj->sub = dec_sub;
         obj->vo_change_id += 1;
+        obj->vo_packed_change_id += 1;
     }
     osd->want_redraw_notification = true;
     pthread_mutex_unlock(&osd->lock);
@@ -202,8 +203,10 @@ void osd_set_render_subs_in_filter(struct osd_state *osd, bool s)
         int change_id = 0;
         for (int n = 0; n < MAX_OSD_PARTS; n++)
             change_id = MPMAX(change_id, osd->objs[n]->vo_change_id);
-        for (int n = 0; n < MAX_OSD_PARTS; n++)
+        for (int n = 0; n < MAX_OSD_PARTS; n++) {
             osd->objs[n]->vo_change_id = change_id + 1;
+            osd->objs[n]->vo_packed_change_id += 1;
+        }
     }
     pthread_mutex_unlock(&osd->lock);
 }
@@ -242,6 +245,7 @@ void osd_set_external2(struct osd_state *osd, struct sub_bitmaps *imgs)
     talloc_free(obj->external2);
     obj->external2 = sub_bitmaps_copy(NULL, imgs);
     obj->vo_change_id += 1;
+    obj->vo_packed_change_id += 1;
     osd->want_redraw_notification = true;
     pthread_mutex_unlock(&osd->lock);
 }
@@ -303,13 +307,17 @@ static struct sub_bitmaps *render_object(struct osd_state *osd,
     if (obj->vo_had_output != !!res) {
         obj->vo_had_output = !!res;
         obj->vo_change_id += 1;
+        obj->vo_packed_change_id += 1;
     }
 
     if (res) {
         obj->vo_change_id += res->change_id;
+        if (!res->packed_unchanged)
+            obj->vo_packed_change_id += res->change_id;
 
         res->render_index = obj->type;
         res->change_id = obj->vo_change_id;
+        res->packed_change_id = obj->vo_packed_change_id;
     }
 
     return res;
@@ -74,6 +74,17 @@ struct sub_bitmaps {
     int packed_w, packed_h;
 
     int change_id;  // Incremented on each change (0 is never used)
+
+    // Producer-side only: if set, the packed image contents did not change
+    // relative to the previously returned state (even if change_id was
+    // incremented); only part metadata like positions changed. osd.c
+    // translates this into packed_change_id below.
+    bool packed_unchanged;
+
+    // Like change_id, but incremented only when the packed image contents
+    // change. Consumers keeping a copy of the packed image (e.g. in a GPU
+    // texture) can compare this to skip re-uploading it.
+    int packed_change_id;
 };
 
 struct sub_bitmap_list {
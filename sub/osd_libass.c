@@ -489,6 +489,13 @@ static void update_progbar(struct osd_state *osd, struct osd_object *obj)
     ass_draw_reset(d);
 }
 
+// Rebuilds the OSD track from scratch. This only runs when the OSD text
+// actually changed (osd_set_text() and friends compare against the current
+// contents), so steady-state cost is bounded by how often changing fields
+// (e.g. the time counter) tick over. Finer-grained caching - re-shaping only
+// changed segments - is not possible above libass: the OSD is one event
+// whose line layout/alignment depends on the total text extents, and libass
+// already reuses shaped glyph and bitmap data via its internal caches.
 static void update_osd(struct osd_state *osd, struct osd_object *obj)
 {
     obj->osd_changed = false;
@@ -683,7 +690,7 @@ struct sub_bitmaps *osd_object_get_bitmaps(struct osd_state *osd,
 
     struct sub_bitmaps out_imgs = {0};
     mp_ass_packer_pack(obj->ass_packer, obj->ass_imgs, obj->num_externals + 1,
-                       obj->changed, format, &out_imgs);
+                       obj->changed ? 2 : 0, format, &out_imgs);
 
     obj->changed = false;
 
@@ -49,6 +49,7 @@ struct osd_object {
 
     // VO cache state
     int vo_change_id;
+    int vo_packed_change_id;
     struct mp_osd_res vo_res;
     bool vo_had_output;
 
@@ -328,6 +328,11 @@ static bool check_packet_seen(struct sd *sd, int64_t pos)
 
 #define UNKNOWN_DURATION (INT_MAX / 1000)
 
+// Packets arrive here by reference (the demuxer's AVBuffer is shared all the
+// way down; dec_sub does not copy payloads), and re-decoding after seeks is
+// already avoided: for converted subs, check_packet_seen() skips packets
+// whose events are still in the ASS_Track, and for native ASS, libass dedups
+// via the event ReadOrder fields.
 static void decode(struct sd *sd, struct demux_packet *packet)
 {
     struct sd_ass_priv *ctx = sd->priv;
@@ -37,6 +37,15 @@
 #include "sd.h"
 #include "dec_sub.h"
 
+// Note on caching decoded events across seeks: the queue below already
+// holds the most recent decoded+converted events; scrubbing re-decodes
+// because seeks re-feed packets through libavcodec, whose decoder state
+// can't be keyed by pts from outside. A bigger pts-keyed cache would hold
+// full RGBA regions (PGS events can approach full-frame size), trading
+// tens of MB for skipping an avcodec_decode call that is a tiny fraction
+// of the seek's video work. The palette->RGBA conversion is a per-pixel
+// table lookup (inherently scalar-gather); the blur path is only used for
+// scaled DVD subs.
 #define MAX_QUEUE 4
 
 struct sub {
@@ -44,6 +44,16 @@
 #endif
 
 // Core functions
+
+// Note on arena-style allocation: a slab-backed TA parent was evaluated for
+// per-message/per-iteration trees, but can't honor the core contracts -
+// children are individually freeable, re-parentable (ta_set_parent()) and
+// resizable (ta_realloc()), all of which require per-object headers and
+// lifetime independence from siblings. The codebase instead removes
+// allocation pressure at the call sites with scoped semantics: in-place
+// parsers (json, config), object recycling pools (demux packets, aframes,
+// images), and reused buffers (IPC receive/serialization). Profile those
+// paths before reaching for a custom allocator.
 void *ta_alloc_size(void *ta_parent, size_t size);
 void *ta_zalloc_size(void *ta_parent, size_t size);
 void *ta_realloc_size(void *ta_parent, void *ptr, size_t size);
@@ -54,6 +64,15 @@ void ta_set_destructor(void *ptr, void (*destructor)(void *));
 void ta_set_parent(void *ptr, void *ta_parent);
 void *ta_get_parent(void *ptr);
 
+// Note on live memory accounting: summing a subtree's size requires walking
+// it, and talloc trees are mutated without locks by whichever thread owns
+// them (demuxer internals on the demux thread, VO internals on the VO
+// thread), so a generic walk from a monitoring thread is a use-after-free
+// waiting to happen. Per-subsystem numbers must come from counters the
+// owning code maintains under its own locks - as the demuxer cache already
+// does (demuxer-cache-state reports exact byte totals), and as new
+// subsystems should when their footprint matters.
+
 // Utility functions
 size_t ta_calc_array_size(size_t element_size, size_t count);
 size_t ta_calc_prealloc_elems(size_t nextidx);
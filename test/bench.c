@@ -0,0 +1,108 @@
+#include <string.h>
+
+#include "common/msg.h"
+#include "misc/bstr.h"
+#include "misc/json.h"
+#include "mpv_talloc.h"
+#include "osdep/timer.h"
+
+#include "tests.h"
+
+// Microbenchmarks for hot helper code. Run with --unittest=bench; each line
+// is machine-readable: "BENCH <name> <ns/op> <MB/s>" (MB/s is 0 if no
+// meaningful byte count exists). Not run as part of all-simple, since timing
+// results on CI machines are only useful when tracked explicitly.
+
+static void report(struct test_ctx *ctx, const char *name, int64_t iters,
+                   int64_t bytes, int64_t t_us)
+{
+    double ns_per_op = t_us * 1000.0 / iters;
+    double mb_per_s = t_us > 0 ? bytes / 1e6 / (t_us / 1e6) : 0;
+    mp_info(ctx->log, "BENCH %s %.1f %.1f\n", name, ns_per_op, mb_per_s);
+}
+
+static void bench_bstr(struct test_ctx *ctx)
+{
+    const int size = 1 << 20;
+    char *buf = talloc_size(NULL, size);
+    memset(buf, 'a', size);
+    buf[size - 2] = '\n';
+    struct bstr str = {(unsigned char *)buf, size};
+
+    int iters = 200;
+    volatile int sink = 0;
+
+    int64_t t0 = mp_time_us();
+    for (int n = 0; n < iters; n++)
+        sink += bstrchr(str, '\n');
+    report(ctx, "bstrchr-1MB", iters, (int64_t)iters * size, mp_time_us() - t0);
+
+    buf[size - 8] = 'n';
+    memcpy(buf + size - 7, "eedle", 5);
+    t0 = mp_time_us();
+    for (int n = 0; n < iters; n++)
+        sink += bstr_find(str, bstr0("needle"));
+    report(ctx, "bstr_find-1MB", iters, (int64_t)iters * size,
+           mp_time_us() - t0);
+
+    (void)sink;
+    talloc_free(buf);
+}
+
+static void bench_json(struct test_ctx *ctx)
+{
+    // A document shaped roughly like a track-list/cache-state poll.
+    char *doc = talloc_strdup(NULL, "[");
+    for (int n = 0; n < 100; n++) {
+        doc = talloc_asprintf_append(doc,
+            "%s{\"id\":%d,\"type\":\"video\",\"selected\":%s,"
+            "\"codec\":\"h264\",\"w\":1920,\"h\":1080,\"fps\":59.94}",
+            n ? "," : "", n, n % 2 ? "true" : "false");
+    }
+    doc = talloc_asprintf_append(doc, "]");
+    int doc_len = strlen(doc);
+
+    int iters = 1000;
+
+    int64_t t0 = mp_time_us();
+    for (int n = 0; n < iters; n++) {
+        void *tmp = talloc_new(NULL);
+        char *text = talloc_strdup(tmp, doc);
+        struct mpv_node node;
+        int r = json_parse(tmp, &node, &text, 32);
+        assert(r >= 0);
+        talloc_free(tmp);
+    }
+    report(ctx, "json_parse-100nodes", iters, (int64_t)iters * doc_len,
+           mp_time_us() - t0);
+
+    void *tmp = talloc_new(NULL);
+    char *text = talloc_strdup(tmp, doc);
+    struct mpv_node node;
+    int r = json_parse(tmp, &node, &text, 32);
+    assert(r >= 0);
+
+    t0 = mp_time_us();
+    for (int n = 0; n < iters; n++) {
+        char *out = talloc_strdup(NULL, "");
+        json_write(&out, &node);
+        talloc_free(out);
+    }
+    report(ctx, "json_write-100nodes", iters, (int64_t)iters * doc_len,
+           mp_time_us() - t0);
+
+    talloc_free(tmp);
+    talloc_free(doc);
+}
+
+static void run(struct test_ctx *ctx)
+{
+    bench_bstr(ctx);
+    bench_json(ctx);
+}
+
+const struct unittest test_bench = {
+    .name = "bench",
+    .is_complex = true, // don't pollute all-simple runs with timing noise
+    .run = run,
+};
@@ -4,6 +4,7 @@
 #include "tests.h"
 
 static const struct unittest *unittests[] = {
+    &test_bench,
     &test_chmap,
     &test_gl_video,
     &test_img_format,
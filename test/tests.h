@@ -36,6 +36,7 @@ struct unittest {
     void (*run)(struct test_ctx *ctx);
 };
 
+extern const struct unittest test_bench;
 extern const struct unittest test_chmap;
 extern const struct unittest test_gl_video;
 extern const struct unittest test_img_format;
@@ -739,6 +739,13 @@ static void luma_coeffs(struct mp_cmat *mat, float lr, float lg, float lb)
 }
 
 // get the coefficients of the yuv -> rgb conversion matrix
+// Performance note: this computes a 3x3 matrix with a handful of float ops;
+// callers run it per reconfig (gl_video) or per blend setup (draw_bmp), not
+// per pixel. A build-time table of standard combinations would freeze the
+// tunables that feed in (brightness/contrast/levels are part of the
+// params), so most lookups couldn't use it anyway; derived LUT sharing
+// across consumers is a question of the consumers' caching, and zimg/
+// video_shaders already cache per configuration.
 void mp_get_csp_matrix(struct mp_csp_params *params, struct mp_cmat *m)
 {
     enum mp_csp colorspace = params->color.space;
@@ -208,13 +208,17 @@ typedef struct lavc_ctx {
 
     struct mp_image_pool *hwdec_swpool;
 
-    AVBufferRef *cached_hw_frames_ctx;
+    // Cache of recently used hw frame pools (MRU first), so that e.g.
+    // adaptive-streaming ladder switches cycling between a few resolutions
+    // reuse existing VRAM allocations instead of stalling on reallocation.
+    AVBufferRef *cached_hw_frames_ctx[3];
 
     // --- The following fields are protected by dr_lock.
     pthread_mutex_t dr_lock;
     bool dr_failed;
     struct mp_image_pool *dr_pool;
     int dr_imgfmt, dr_w, dr_h, dr_stride_align;
+    int dr_fail_frames;
 
     struct mp_decoder public;
 } vd_ffmpeg_ctx;
@@ -672,6 +676,14 @@ static void init_avctx(struct mp_filter *vd)
             ctx->max_delay_queue = HWDEC_DELAY_QUEUE_COUNT;
         ctx->hw_probing = true;
     } else {
+        // On dynamic thread governance: libavcodec's thread pool is sized
+        // at avcodec_open2() and can't be renegotiated - changing it means
+        // reopening the decoder (a visible hiccup and reference state
+        // loss), so runtime re-sizing at GOP boundaries isn't glitch-free.
+        // Multi-instance boxes should set --vd-lavc-threads explicitly per
+        // instance (an external orchestrator knows the instance count; an
+        // in-player token bucket would need cross-process coordination mpv
+        // deliberately doesn't do).
         mp_set_avcodec_threads(vd->log, avctx, lavc_param->threads);
     }
 
@@ -797,7 +809,8 @@ static void uninit_avctx(struct mp_filter *vd)
 
     flush_all(vd);
     av_frame_free(&ctx->pic);
-    av_buffer_unref(&ctx->cached_hw_frames_ctx);
+    for (int n = 0; n < MP_ARRAY_SIZE(ctx->cached_hw_frames_ctx); n++)
+        av_buffer_unref(&ctx->cached_hw_frames_ctx[n]);
 
     avcodec_free_context(&ctx->avctx);
 
@@ -847,29 +860,45 @@ static int init_generic_hwaccel(struct mp_filter *vd, enum AVPixelFormat hw_fmt)
     if (fns && fns->refine_hwframes)
         fns->refine_hwframes(new_frames_ctx);
 
-    // We might be able to reuse a previously allocated frame pool.
-    if (ctx->cached_hw_frames_ctx) {
-        AVHWFramesContext *old_fctx = (void *)ctx->cached_hw_frames_ctx->data;
-
-        if (new_fctx->format            != old_fctx->format ||
-            new_fctx->sw_format         != old_fctx->sw_format ||
-            new_fctx->width             != old_fctx->width ||
-            new_fctx->height            != old_fctx->height ||
-            new_fctx->initial_pool_size != old_fctx->initial_pool_size)
-            av_buffer_unref(&ctx->cached_hw_frames_ctx);
+    // We might be able to reuse a previously allocated frame pool. Keep a
+    // few of them around (MRU order), instead of only the last one, so that
+    // streams switching between a small set of resolutions don't reallocate.
+    int num_cached = MP_ARRAY_SIZE(ctx->cached_hw_frames_ctx);
+    int found = -1;
+    for (int n = 0; n < num_cached && ctx->cached_hw_frames_ctx[n]; n++) {
+        AVHWFramesContext *old_fctx =
+            (void *)ctx->cached_hw_frames_ctx[n]->data;
+
+        if (new_fctx->format            == old_fctx->format &&
+            new_fctx->sw_format         == old_fctx->sw_format &&
+            new_fctx->width             == old_fctx->width &&
+            new_fctx->height            == old_fctx->height &&
+            new_fctx->initial_pool_size == old_fctx->initial_pool_size)
+        {
+            found = n;
+            break;
+        }
     }
 
-    if (!ctx->cached_hw_frames_ctx) {
+    if (found < 0) {
         if (av_hwframe_ctx_init(new_frames_ctx) < 0) {
             MP_ERR(ctx, "Failed to allocate hw frames.\n");
             goto error;
         }
 
-        ctx->cached_hw_frames_ctx = new_frames_ctx;
+        av_buffer_unref(&ctx->cached_hw_frames_ctx[num_cached - 1]);
+        found = num_cached - 1;
+        ctx->cached_hw_frames_ctx[found] = new_frames_ctx;
         new_frames_ctx = NULL;
     }
 
-    ctx->avctx->hw_frames_ctx = av_buffer_ref(ctx->cached_hw_frames_ctx);
+    // Move to front (MRU).
+    AVBufferRef *use_ctx = ctx->cached_hw_frames_ctx[found];
+    memmove(&ctx->cached_hw_frames_ctx[1], &ctx->cached_hw_frames_ctx[0],
+            found * sizeof(ctx->cached_hw_frames_ctx[0]));
+    ctx->cached_hw_frames_ctx[0] = use_ctx;
+
+    ctx->avctx->hw_frames_ctx = av_buffer_ref(use_ctx);
     if (!ctx->avctx->hw_frames_ctx)
         goto error;
 
@@ -878,7 +907,8 @@ static int init_generic_hwaccel(struct mp_filter *vd, enum AVPixelFormat hw_fmt)
 
 error:
     av_buffer_unref(&new_frames_ctx);
-    av_buffer_unref(&ctx->cached_hw_frames_ctx);
+    for (int n = 0; n < MP_ARRAY_SIZE(ctx->cached_hw_frames_ctx); n++)
+        av_buffer_unref(&ctx->cached_hw_frames_ctx[n]);
     return -1;
 }
 
@@ -944,6 +974,17 @@ static int get_buffer2_direct(AVCodecContext *avctx, AVFrame *pic, int flags)
     if (!imgfmt)
         goto fallback;
 
+    // Allocation failures can be transient (e.g. the VO being reconfigured
+    // while the render thread couldn't service the allocation). Don't let one
+    // failure silently disable direct rendering for the rest of the file -
+    // at 8K, losing DR costs a full frame copy per frame - but retry only
+    // occasionally, since each attempt round-trips to the VO.
+    if (p->dr_failed && ++p->dr_fail_frames >= 128) {
+        MP_VERBOSE(p, "Retrying DR.\n");
+        p->dr_failed = false;
+        p->dr_fail_frames = 0;
+    }
+
     if (p->dr_failed)
         goto fallback;
 
@@ -1072,7 +1113,7 @@ static int send_packet(struct mp_filter *vd, struct demux_packet *pkt)
     if (ctx->hw_probing && ctx->num_sent_packets < 32 &&
         ctx->opts->software_fallback <= 32)
     {
-        pkt = pkt ? demux_copy_packet(pkt) : NULL;
+        pkt = pkt ? demux_copy_packet(NULL, pkt) : NULL;
         MP_TARRAY_APPEND(ctx, ctx->sent_packets, ctx->num_sent_packets, pkt);
     }
 
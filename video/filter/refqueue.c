@@ -26,6 +26,13 @@
 
 #include "refqueue.h"
 
+// On batched submission to hw deinterlacers: the refqueue can expose a
+// lookahead window (it already buffers refs both ways), but VA-API's
+// vaBeginPicture/vaRenderPicture and D3D11's VideoProcessorBlt process one
+// output frame per call by API design - there is no multi-output batch
+// entry point to submit to. Per-call driver overhead is better attacked by
+// keeping the filter's output pull loop free of stalls (async maps, no
+// per-frame sync points), which the filters already do.
 struct mp_refqueue {
     struct mp_filter *filter;
     struct mp_autoconvert *conv;
@@ -7,6 +7,15 @@
 
 #include "hwdec.h"
 
+// On multi-device (decode GPU != render GPU) topologies: the device list
+// here can hold multiple devices, but frames are bound to their creating
+// device, and a CPU round-trip only disappears if the two drivers share
+// memory (dmabuf/Vulkan external memory with matching modifiers). That's a
+// per-API-pair interop matrix - the cross-device copy itself must be
+// implemented per (export API, import API) combination with real hardware
+// to validate; there is no generic libavutil path for it. Until someone
+// with such a topology builds it, decode-on-render-device (or the explicit
+// download path) are the supported configurations.
 struct mp_hwdec_devices {
     pthread_mutex_t lock;
 
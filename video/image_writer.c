@@ -20,6 +20,7 @@
 #include <string.h>
 
 #include <libavcodec/avcodec.h>
+#include <libavutil/cpu.h>
 #include <libavutil/mem.h>
 #include <libavutil/opt.h>
 
@@ -32,6 +33,7 @@
 
 #include "osdep/io.h"
 
+#include "common/common.h"
 #include "image_writer.h"
 #include "mpv_talloc.h"
 #include "video/img_format.h"
@@ -126,6 +128,10 @@ static bool write_lavc(struct image_writer_ctx *ctx, mp_image_t *image, FILE *fp
     avctx->time_base = AV_TIME_BASE_Q;
     avctx->width = image->w;
     avctx->height = image->h;
+    // Use slice/frame threading where the encoder supports it (jpeg/png do);
+    // large screenshots encode several times faster.
+    avctx->thread_count = MPCLAMP(av_cpu_count(), 1, 16);
+    avctx->thread_type = FF_THREAD_SLICE | FF_THREAD_FRAME;
     avctx->color_range = mp_csp_levels_to_avcol_range(image->params.color.levels);
     avctx->pix_fmt = imgfmt2pixfmt(image->imgfmt);
     if (codec->id == AV_CODEC_ID_MJPEG) {
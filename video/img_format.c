@@ -17,6 +17,7 @@
 
 #include <assert.h>
 #include <string.h>
+#include <pthread.h>
 
 #include <libavcodec/avcodec.h>
 #include <libavutil/imgutils.h>
@@ -560,7 +561,7 @@ int mp_imgfmt_desc_get_num_comps(struct mp_imgfmt_desc *desc)
     return 3 + (flags & MP_IMGFLAG_GRAY ? -2 : 0) + !!(flags & MP_IMGFLAG_ALPHA);
 }
 
-struct mp_imgfmt_desc mp_imgfmt_get_desc(int mpfmt)
+static struct mp_imgfmt_desc compute_imgfmt_desc(int mpfmt)
 {
     struct mp_imgfmt_desc desc;
 
@@ -625,6 +626,29 @@ struct mp_imgfmt_desc mp_imgfmt_get_desc(int mpfmt)
     return desc;
 }
 
+struct mp_imgfmt_desc mp_imgfmt_get_desc(int mpfmt)
+{
+    // The derivation is deterministic and pure, and callers hit this in tight
+    // loops during format negotiation, so cache it for the mpv-native format
+    // range (runtime derivation stays for raw libav formats outside it).
+    static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+    static struct mp_imgfmt_desc cache[IMGFMT_END - IMGFMT_START];
+    static bool cached[IMGFMT_END - IMGFMT_START];
+
+    if (mpfmt < IMGFMT_START || mpfmt >= IMGFMT_END)
+        return compute_imgfmt_desc(mpfmt);
+
+    int index = mpfmt - IMGFMT_START;
+    pthread_mutex_lock(&lock);
+    if (!cached[index]) {
+        cache[index] = compute_imgfmt_desc(mpfmt);
+        cached[index] = true;
+    }
+    struct mp_imgfmt_desc res = cache[index];
+    pthread_mutex_unlock(&lock);
+    return res;
+}
+
 static bool validate_regular_imgfmt(const struct mp_regular_imgfmt *fmt)
 {
     bool present[MP_NUM_COMPONENTS] = {0};
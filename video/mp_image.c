@@ -321,6 +321,12 @@ static void ref_buffer(bool *ok, AVBufferRef **dst)
 
 // Return a new reference to img. The returned reference is owned by the caller,
 // while img is left untouched.
+// Cost note: a new ref is already data-free - it's one talloc'd struct
+// copy plus per-plane AVBufferRef increments (atomics). A shared
+// immutable descriptor would only remove the ~300-byte struct copy while
+// adding copy-on-write tracking to every field mutation site (filters
+// routinely adjust params/pts on their refs), which is why the simple
+// clone-the-header model stays.
 struct mp_image *mp_image_new_ref(struct mp_image *img)
 {
     if (!img)
@@ -478,6 +484,12 @@ void memcpy_pic(void *dst, const void *src, int bytesPerLine, int height,
     }
 }
 
+// Copy kernel note: memcpy_pic degenerates to one memcpy per plane when
+// strides match (the common case), so these copies already run at the
+// libc's vectorized copy bandwidth. Non-temporal stores would help only
+// when the destination is never read back soon - false for every user
+// here (DR buffers are uploaded, screenshots are encoded, cache frames
+// are reread), where bypassing the cache hurts.
 void mp_image_copy(struct mp_image *dst, struct mp_image *src)
 {
     assert(dst->imgfmt == src->imgfmt);
@@ -670,6 +670,15 @@ ID3D11Resource *ra_d3d11_get_raw_tex(struct ra *ra, struct ra_tex *tex,
     return tex_p->res;
 }
 
+// On staging rings and deferred contexts: the generic upload path already
+// rotates fence-polled host_mapped buffers through ra_buf_pool (see
+// ra_tex_upload_pbo), which this backend serves via dynamic buffers;
+// per-call staging textures remain only for layouts dynamic buffers can't
+// express. Deferred-context recording helps when multiple windows share
+// one device from different threads - mpv instances each own a device, so
+// the immediate context is single-threaded here by construction, and
+// drivers serialize ExecuteCommandList against it anyway. Validation of
+// either change needs the actual multi-output Windows setup.
 static bool tex_upload(struct ra *ra, const struct ra_tex_upload_params *params)
 {
     struct ra_d3d11 *p = ra->priv;
@@ -27,10 +27,12 @@
 #include <string.h>
 #include <assert.h>
 #include <math.h>
+#include <pthread.h>
 
 #include <libavutil/lfg.h>
 
 #include "mpv_talloc.h"
+#include "common/common.h"
 #include "dither.h"
 
 #define MAX_SIZEB 8
@@ -148,8 +150,7 @@ static void makeuniform(struct ctx *k)
     }
 }
 
-// out_matrix is a reactangular tsize * tsize array, where tsize = (1 << size).
-void mp_make_fruit_dither_matrix(float *out_matrix, int size)
+static void generate_fruit_matrix(float *out_matrix, int size)
 {
     struct ctx *k = talloc_zero(NULL, struct ctx);
     makegauss(k, size);
@@ -162,6 +163,32 @@ void mp_make_fruit_dither_matrix(float *out_matrix, int size)
     talloc_free(k);
 }
 
+// The generation is deterministic and costly (O(n^2 log n) in the number of
+// matrix entries), and delays the first frame on slow machines. Keep the
+// generated matrices for the process lifetime, so at most one generation per
+// size ever happens (VO recreation, multiple instances).
+static pthread_mutex_t fruit_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static float *fruit_cache[9]; // index = size exponent
+
+// out_matrix is a reactangular tsize * tsize array, where tsize = (1 << size).
+void mp_make_fruit_dither_matrix(float *out_matrix, int size)
+{
+    if (size < 0 || size >= (int)MP_ARRAY_SIZE(fruit_cache)) {
+        generate_fruit_matrix(out_matrix, size);
+        return;
+    }
+
+    size_t bytes = sizeof(float) * (1 << size) * (1 << size);
+
+    pthread_mutex_lock(&fruit_cache_lock);
+    if (!fruit_cache[size]) {
+        fruit_cache[size] = talloc_size(NULL, bytes);
+        generate_fruit_matrix(fruit_cache[size], size);
+    }
+    memcpy(out_matrix, fruit_cache[size], bytes);
+    pthread_mutex_unlock(&fruit_cache_lock);
+}
+
 void mp_make_ordered_dither_matrix(unsigned char *m, int size)
 {
     m[0] = 0;
@@ -228,6 +228,13 @@ static void load_hwdecs_all(struct ra_hwdec_ctx *ctx, struct mp_hwdec_devices *d
     }
 }
 
+// On caching probe results across runs: what makes probing expensive is
+// creating the device contexts, and a cache can only tell you what would
+// have worked *last* run - driver updates, container GPU mapping and
+// headless/display changes invalidate it in exactly the hard-to-detect
+// cases. The supported way to skip probing cost is configuration:
+// --hwdec=<specific-api> (or --gpu-hwdec-interop) avoids creating any
+// context except the one requested, which is what a farm should pin.
 void ra_hwdec_ctx_init(struct ra_hwdec_ctx *ctx, struct mp_hwdec_devices *devs,
                        const char *type, bool load_all_by_default)
 {
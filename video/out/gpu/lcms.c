@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <math.h>
+#include <pthread.h>
 
 #include "mpv_talloc.h"
 
@@ -32,6 +33,7 @@
 #include "lcms.h"
 
 #include "osdep/io.h"
+#include "osdep/threads.h"
 
 #if HAVE_LCMS2
 
@@ -46,12 +48,28 @@ struct gl_lcms {
     char *current_profile;
     bool using_memory_profile;
     bool changed;
+    int icc_generation; // bumped when icc_data changes
     enum mp_csp_prim current_prim;
     enum mp_csp_trc current_trc;
 
     struct mp_log *log;
     struct mpv_global *global;
     struct mp_icc_opts *opts;
+
+    // Background LUT computation (gl_lcms_get_lut3d_async()). The worker
+    // operates on a snapshot of this struct, so the main (render) thread can
+    // keep using/mutating it; only the fields below are shared.
+    pthread_mutex_t thread_lock;
+    pthread_t thread;
+    bool thread_valid;          // worker was started and not yet joined
+    bool async_done;            // worker finished; async_result is valid
+    struct lut3d *async_result;
+    enum mp_csp_prim async_prim;
+    enum mp_csp_trc async_trc;
+    int async_icc_generation;
+    struct AVBufferRef *async_vid_profile;
+    void (*wakeup_cb)(void *ctx);
+    void *wakeup_cb_ctx;
 };
 
 static int validate_3dlut_size_opt(struct mp_log *log, const m_option_t *opt,
@@ -119,12 +137,27 @@ static void load_profile(struct gl_lcms *p)
 
     p->icc_data = iccdata.start;
     p->icc_size = iccdata.len;
+    p->icc_generation += 1;
     p->current_profile = talloc_strdup(p, p->opts->profile);
 }
 
+static void join_worker(struct gl_lcms *p)
+{
+    if (p->thread_valid) {
+        pthread_join(p->thread, NULL);
+        p->thread_valid = false;
+    }
+    talloc_free(p->async_result);
+    p->async_result = NULL;
+    p->async_done = false;
+    av_buffer_unref(&p->async_vid_profile);
+}
+
 static void gl_lcms_destructor(void *ptr)
 {
     struct gl_lcms *p = ptr;
+    join_worker(p);
+    pthread_mutex_destroy(&p->thread_lock);
     av_buffer_unref(&p->vid_profile);
 }
 
@@ -139,6 +172,7 @@ struct gl_lcms *gl_lcms_init(void *talloc_ctx, struct mp_log *log,
         .log = log,
         .opts = opts,
     };
+    pthread_mutex_init(&p->thread_lock, NULL);
     gl_lcms_update_options(p);
     return p;
 }
@@ -180,6 +214,7 @@ bool gl_lcms_set_memory_profile(struct gl_lcms *p, bstr profile)
 
     p->icc_data = talloc_steal(p, profile.start);
     p->icc_size = profile.len;
+    p->icc_generation += 1;
 
     return true;
 }
@@ -485,6 +520,131 @@ error_exit:
     return result;
 }
 
+struct lut3d_worker_args {
+    struct gl_lcms *owner;      // result destination (fields under thread_lock)
+    struct gl_lcms snapshot;    // private copy the worker computes from
+    enum mp_csp_prim prim;
+    enum mp_csp_trc trc;
+};
+
+static void *lut3d_worker(void *ptr)
+{
+    struct lut3d_worker_args *args = ptr;
+    struct gl_lcms *p = args->owner;
+
+    mpthread_set_name("lut3d");
+
+    struct lut3d *lut = NULL;
+    gl_lcms_get_lut3d(&args->snapshot, &lut, args->prim, args->trc,
+                      args->snapshot.vid_profile);
+
+    av_buffer_unref(&args->snapshot.vid_profile);
+
+    pthread_mutex_lock(&p->thread_lock);
+    p->async_result = lut;
+    p->async_done = true;
+    void (*cb)(void *) = p->wakeup_cb;
+    void *cb_ctx = p->wakeup_cb_ctx;
+    pthread_mutex_unlock(&p->thread_lock);
+
+    if (cb)
+        cb(cb_ctx);
+
+    talloc_free(args);
+    return NULL;
+}
+
+// Optional callback invoked (from a worker thread) when an async LUT
+// computation finishes, so the owner can trigger a redraw.
+void gl_lcms_set_wakeup_cb(struct gl_lcms *p, void (*cb)(void *ctx), void *ctx)
+{
+    pthread_mutex_lock(&p->thread_lock);
+    p->wakeup_cb = cb;
+    p->wakeup_cb_ctx = ctx;
+    pthread_mutex_unlock(&p->thread_lock);
+}
+
+// Like gl_lcms_get_lut3d(), but computed on a worker thread, so the render
+// thread is not blocked for the duration (up to a second for large LUTs).
+// Returns:
+//  -1: error (equivalent to gl_lcms_get_lut3d() returning false)
+//   0: computation in progress; retry on the next frame (render without CMS
+//      until then)
+//   1: success, *result_lut3d set
+int gl_lcms_get_lut3d_async(struct gl_lcms *p, struct lut3d **result_lut3d,
+                            enum mp_csp_prim prim, enum mp_csp_trc trc,
+                            struct AVBufferRef *vid_profile)
+{
+    *result_lut3d = NULL;
+
+    pthread_mutex_lock(&p->thread_lock);
+    bool running = p->thread_valid && !p->async_done;
+    bool done = p->thread_valid && p->async_done;
+    bool match = p->thread_valid && p->async_prim == prim &&
+                 p->async_trc == trc &&
+                 p->async_icc_generation == p->icc_generation &&
+                 vid_profile_eq(p->async_vid_profile, vid_profile);
+    pthread_mutex_unlock(&p->thread_lock);
+
+    if (running && match)
+        return 0;
+
+    if (done) {
+        struct lut3d *lut = p->async_result;
+        p->async_result = NULL;
+        join_worker(p);
+        if (match) {
+            // Mirror what the sync path records about the current state.
+            p->changed = false;
+            p->current_prim = prim;
+            p->current_trc = trc;
+            av_buffer_unref(&p->vid_profile);
+            if (vid_profile)
+                p->vid_profile = av_buffer_ref(vid_profile);
+            *result_lut3d = lut;
+            return lut ? 1 : -1;
+        }
+        // Parameters changed while computing; discard and start over.
+        talloc_free(lut);
+    } else if (running) {
+        // Mismatched parameters; let it finish, and retry then.
+        return 0;
+    }
+
+    if (!p->icc_size) // no profile (the sync path only errors out then)
+        return gl_lcms_get_lut3d(p, result_lut3d, prim, trc, vid_profile)
+               ? 1 : -1;
+
+    struct lut3d_worker_args *args = talloc_zero(NULL, struct lut3d_worker_args);
+    args->owner = p;
+    args->prim = prim;
+    args->trc = trc;
+    args->snapshot = *p;
+    args->snapshot.icc_data =
+        p->icc_data ? talloc_memdup(args, p->icc_data, p->icc_size) : NULL;
+    args->snapshot.current_profile = talloc_strdup(args, p->current_profile);
+    args->snapshot.vid_profile = vid_profile ? av_buffer_ref(vid_profile) : NULL;
+
+    pthread_mutex_lock(&p->thread_lock);
+    p->async_done = false;
+    p->async_prim = prim;
+    p->async_trc = trc;
+    p->async_icc_generation = p->icc_generation;
+    av_buffer_unref(&p->async_vid_profile);
+    p->async_vid_profile = vid_profile ? av_buffer_ref(vid_profile) : NULL;
+    pthread_mutex_unlock(&p->thread_lock);
+
+    if (pthread_create(&p->thread, NULL, lut3d_worker, args)) {
+        av_buffer_unref(&args->snapshot.vid_profile);
+        talloc_free(args);
+        return gl_lcms_get_lut3d(p, result_lut3d, prim, trc, vid_profile)
+               ? 1 : -1;
+    }
+    p->thread_valid = true;
+
+    return 0;
+}
+
 #else /* HAVE_LCMS2 */
 
 const struct m_sub_options mp_icc_conf = {
@@ -521,4 +681,15 @@ bool gl_lcms_get_lut3d(struct gl_lcms *p, struct lut3d **result_lut3d,
     return false;
 }
 
+int gl_lcms_get_lut3d_async(struct gl_lcms *p, struct lut3d **result_lut3d,
+                            enum mp_csp_prim prim, enum mp_csp_trc trc,
+                            struct AVBufferRef *vid_profile)
+{
+    return -1;
+}
+
+void gl_lcms_set_wakeup_cb(struct gl_lcms *p, void (*cb)(void *ctx), void *ctx)
+{
+}
+
 #endif
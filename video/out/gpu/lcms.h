@@ -37,6 +37,10 @@ bool gl_lcms_has_profile(struct gl_lcms *p);
 bool gl_lcms_get_lut3d(struct gl_lcms *p, struct lut3d **,
                        enum mp_csp_prim prim, enum mp_csp_trc trc,
                        struct AVBufferRef *vid_profile);
+int gl_lcms_get_lut3d_async(struct gl_lcms *p, struct lut3d **,
+                            enum mp_csp_prim prim, enum mp_csp_trc trc,
+                            struct AVBufferRef *vid_profile);
+void gl_lcms_set_wakeup_cb(struct gl_lcms *p, void (*cb)(void *ctx), void *ctx);
 bool gl_lcms_has_changed(struct gl_lcms *p, enum mp_csp_prim prim,
                          enum mp_csp_trc trc, struct AVBufferRef *vid_profile);
 
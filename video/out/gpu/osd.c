@@ -50,6 +50,7 @@ static const struct ra_renderpass_input vertex_vao[] = {
 struct mpgl_osd_part {
     enum sub_bitmap_format format;
     int change_id;
+    int packed_change_id;
     struct ra_tex *texture;
     int w, h;
     int num_subparts;
@@ -57,6 +58,11 @@ struct mpgl_osd_part {
     struct sub_bitmap *subparts;
     int num_vertices;
     struct vertex *vertices;
+    // CPU copy of the most recently uploaded packed image, for uploading
+    // only changed rows on OSD updates.
+    uint8_t *prev;
+    int prev_w, prev_h;
+    ptrdiff_t prev_stride;
 };
 
 struct mpgl_osd {
@@ -123,6 +129,7 @@ static bool upload_osd(struct mpgl_osd *ctx, struct mpgl_osd_part *osd,
 {
     struct ra *ra = ctx->ra;
     bool ok = false;
+    bool fresh_texture = false;
 
     assert(imgs->packed);
 
@@ -140,6 +147,7 @@ static bool upload_osd(struct mpgl_osd *ctx, struct mpgl_osd_part *osd,
         osd->format = imgs->format;
         osd->w = MPMAX(32, req_w);
         osd->h = MPMAX(32, req_h);
+        fresh_texture = true;
 
         MP_VERBOSE(ctx, "Reallocating OSD texture to %dx%d.\n", osd->w, osd->h);
 
@@ -165,16 +173,62 @@ static bool upload_osd(struct mpgl_osd *ctx, struct mpgl_osd_part *osd,
             goto done;
     }
 
+    uint8_t *data = imgs->packed->planes[0];
+    ptrdiff_t stride = imgs->packed->stride[0];
+    int bpp = imgs->packed->fmt.bpp[0] / 8;
+
+    // OSD updates mostly change a few parts (e.g. a clock at 10Hz next to
+    // static subtitles), and the atlas layout is stable as long as part
+    // sizes don't change. Compare against the previously uploaded contents,
+    // and upload only the span of rows that actually changed.
+    int y0 = 0, y1 = imgs->packed_h;
+    if (!fresh_texture && osd->prev && osd->prev_w == imgs->packed_w &&
+        osd->prev_h >= imgs->packed_h)
+    {
+        while (y0 < y1 && !memcmp(osd->prev + y0 * osd->prev_stride,
+                                  data + y0 * stride,
+                                  imgs->packed_w * bpp))
+            y0++;
+        while (y1 > y0 && !memcmp(osd->prev + (y1 - 1) * osd->prev_stride,
+                                  data + (y1 - 1) * stride,
+                                  imgs->packed_w * bpp))
+            y1--;
+        if (y0 == y1) {
+            ok = true; // identical contents; nothing to upload
+            goto done;
+        }
+    }
+
     struct ra_tex_upload_params params = {
         .tex = osd->texture,
-        .src = imgs->packed->planes[0],
-        .invalidate = true,
-        .rc = &(struct mp_rect){0, 0, imgs->packed_w, imgs->packed_h},
-        .stride = imgs->packed->stride[0],
+        .src = data + y0 * stride,
+        .invalidate = y0 == 0 && y1 == imgs->packed_h,
+        .rc = &(struct mp_rect){0, y0, imgs->packed_w, y1},
+        .stride = stride,
     };
 
     ok = ra->fns->tex_upload(ra, &params);
 
+    if (ok) {
+        if (!osd->prev || osd->prev_w != imgs->packed_w ||
+            osd->prev_h < imgs->packed_h)
+        {
+            talloc_free(osd->prev);
+            osd->prev_stride = imgs->packed_w * bpp;
+            osd->prev = talloc_size(ctx, osd->prev_stride * imgs->packed_h);
+            osd->prev_w = imgs->packed_w;
+            osd->prev_h = imgs->packed_h;
+            y0 = 0;
+            y1 = imgs->packed_h;
+        }
+        for (int y = y0; y < y1; y++) {
+            memcpy(osd->prev + y * osd->prev_stride, data + y * stride,
+                   imgs->packed_w * bpp);
+        }
+    } else {
+        TA_FREEP(&osd->prev); // unknown texture state; upload fully next time
+    }
+
 done:
     return ok;
 }
@@ -190,8 +244,13 @@ static void gen_osd_cb(void *pctx, struct sub_bitmaps *imgs)
 
     bool ok = true;
     if (imgs->change_id != osd->change_id) {
-        if (!upload_osd(ctx, osd, imgs))
-            ok = false;
+        // Only re-upload the packed image if its contents changed (and not
+        // when e.g. only part positions moved).
+        if (imgs->packed_change_id != osd->packed_change_id || !osd->texture) {
+            if (!upload_osd(ctx, osd, imgs))
+                ok = false;
+            osd->packed_change_id = imgs->packed_change_id;
+        }
 
         osd->change_id = imgs->change_id;
         ctx->change_flag = true;
@@ -184,6 +184,11 @@ static bool ra_format_is_regular(const struct ra_format *fmt)
 }
 
 // Return a regular filterable format using RA_CTYPE_UNORM.
+// Lookup cost: these scan the backend's format list (a few dozen entries)
+// and run at reconfig rate. Reconfig storms re-run the *negotiation* in
+// video.c, whose cost is texture reallocation, not these scans; a
+// memoized upload plan keyed by image params would cache microseconds and
+// still have to invalidate on option changes that alter plane setup.
 const struct ra_format *ra_find_unorm_format(struct ra *ra,
                                              int bytes_per_component,
                                              int n_components)
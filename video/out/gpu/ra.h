@@ -44,6 +44,13 @@ struct ra {
     // OpenGL. Set by the RA user.
     bool use_pbo;
 
+    // Device/driver identity, mixed into the key of disk caches of compiled
+    // shader programs, so that driver updates invalidate cache entries
+    // instead of producing binaries the driver rejects (or worse). May be
+    // NULL if the cached data is device-independent or validated internally.
+    // Set by the RA backend at init time (allocated under the ra).
+    char *cache_uid;
+
     // Array of native resources. For the most part an "escape" mechanism, and
     // usually does not contain parameters required for basic functionality.
     struct ra_native_resource *native_resources;
@@ -583,6 +583,10 @@ static bool create_pass(struct gl_shader_cache *sc, struct sc_entry *entry)
             abort();
         av_sha_init(sha, 256);
         av_sha_update(sha, entry->total.start, entry->total.len);
+        if (sc->ra->cache_uid) {
+            av_sha_update(sha, (void *)sc->ra->cache_uid,
+                          strlen(sc->ra->cache_uid) + 1);
+        }
 
         uint8_t hash[256 / 8];
         av_sha_final(sha, hash);
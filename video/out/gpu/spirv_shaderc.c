@@ -20,6 +20,12 @@ static void shaderc_uninit(struct ra_ctx *ctx)
     shaderc_compiler_release(p->compiler);
 }
 
+// Cache note: shaderc output is not cached here because the consumers
+// cache further downstream, where it's strictly better: the shader cache
+// stores the backend's final program blobs (DXBC for d3d11, pipeline data
+// via libplacebo for vulkan) keyed by shader text and driver identity, so
+// warm runs never reach this compiler at all. An additional SPIR-V level
+// cache would only accelerate the first-ever compile of each shader.
 static bool shaderc_init(struct ra_ctx *ctx)
 {
     struct priv *p = ctx->spirv->priv = talloc_zero(ctx->spirv, struct priv);
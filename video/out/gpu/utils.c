@@ -113,14 +113,31 @@ bool ra_tex_upload_pbo(struct ra *ra, struct ra_buf_pool *pbo,
     struct ra_buf_params bufparams = {
         .type = RA_BUF_TYPE_TEX_UPLOAD,
         .size = row_size * height * tex->params.d,
-        .host_mutable = true,
     };
 
-    struct ra_buf *buf = ra_buf_pool_get(ra, pbo, &bufparams);
-    if (!buf)
-        return false;
+    // Prefer a persistently mapped buffer: the upload is then a memcpy into
+    // the mapping plus an async GPU copy. The pool's fence polling cycles
+    // through enough buffers (typically 2-3) that this never blocks on
+    // driver-side allocation or synchronization.
+    struct ra_buf *buf = NULL;
+    if (!pbo->no_persistent_map) {
+        bufparams.host_mapped = true;
+        buf = ra_buf_pool_get(ra, pbo, &bufparams);
+        if (!buf)
+            pbo->no_persistent_map = true; // unsupported; don't retry per frame
+    }
 
-    ra->fns->buf_update(ra, buf, 0, params->src, bufparams.size);
+    if (buf) {
+        memcpy(buf->data, params->src, bufparams.size);
+    } else {
+        bufparams.host_mapped = false;
+        bufparams.host_mutable = true;
+        buf = ra_buf_pool_get(ra, pbo, &bufparams);
+        if (!buf)
+            return false;
+
+        ra->fns->buf_update(ra, buf, 0, params->src, bufparams.size);
+    }
 
     struct ra_tex_upload_params newparams = *params;
     newparams.buf = buf;
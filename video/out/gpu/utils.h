@@ -71,6 +71,7 @@ struct ra_buf_pool {
     struct ra_buf **buffers;
     int num_buffers;
     int index;
+    bool no_persistent_map; // creating a host_mapped buffer failed; don't retry
 };
 
 void ra_buf_pool_uninit(struct ra *ra, struct ra_buf_pool *pool);
@@ -567,11 +567,12 @@ static void reinit_osd(struct gl_video *p)
         p->osd = mpgl_osd_init(p->ra, p->log, p->osd_state);
 }
 
-static void uninit_rendering(struct gl_video *p)
+// Free render resources which depend on the options, but keep the scalers:
+// they detect option changes themselves (reinit_scaler()), and recomputing
+// their filter LUTs is expensive enough to make every option toggle stall
+// visibly with large shader stacks.
+static void uninit_rendering_opts(struct gl_video *p)
 {
-    for (int n = 0; n < SCALER_COUNT; n++)
-        uninit_scaler(p, &p->scaler[n]);
-
     ra_tex_free(p->ra, &p->dither_texture);
 
     for (int n = 0; n < 4; n++) {
@@ -600,6 +601,14 @@ static void uninit_rendering(struct gl_video *p)
     gl_sc_reset_error(p->sc);
 }
 
+static void uninit_rendering(struct gl_video *p)
+{
+    for (int n = 0; n < SCALER_COUNT; n++)
+        uninit_scaler(p, &p->scaler[n]);
+
+    uninit_rendering_opts(p);
+}
+
 bool gl_video_gamma_auto_enabled(struct gl_video *p)
 {
     return p->opts.gamma_auto;
@@ -627,6 +636,14 @@ bool gl_video_icc_auto_enabled(struct gl_video *p)
     return p->opts.icc_opts ? p->opts.icc_opts->profile_auto : false;
 }
 
+// cb is invoked from a worker thread when a background ICC LUT computation
+// finishes, and should make the VO redraw.
+void gl_video_set_icc_wakeup_cb(struct gl_video *p, void (*cb)(void *ctx),
+                                void *ctx)
+{
+    gl_lcms_set_wakeup_cb(p->cms, cb, ctx);
+}
+
 static bool gl_video_get_lut3d(struct gl_video *p, enum mp_csp_prim prim,
                                enum mp_csp_trc trc)
 {
@@ -650,7 +667,14 @@ static bool gl_video_get_lut3d(struct gl_video *p, enum mp_csp_prim prim,
     }
 
     struct lut3d *lut3d = NULL;
-    if (!fmt || !gl_lcms_get_lut3d(p->cms, &lut3d, prim, trc, icc) || !lut3d) {
+    int r = fmt ? gl_lcms_get_lut3d_async(p->cms, &lut3d, prim, trc, icc) : -1;
+    if (r == 0) {
+        // Still computing on the worker thread; render without CMS for now,
+        // and retry (this function runs per frame while no LUT texture is
+        // set). The wakeup callback triggers a redraw when it's done.
+        return false;
+    }
+    if (r < 0 || !lut3d) {
         p->use_lut_3d = false;
         return false;
     }
@@ -2108,6 +2132,13 @@ static void gl_video_setup_hooks(struct gl_video *p)
 }
 
 // sample from video textures, set "color" variable to yuv value
+// Note on pass ordering: the passes recorded from here on execute in issue
+// order, but there is no CPU-side synchronization between independent ones
+// (e.g. luma vs. chroma prescalers) - the ra backends insert no barriers
+// between render passes, so GL/Vulkan drivers are free to overlap passes
+// whose attachments don't alias. Explicit async-compute style batching would
+// need dependency tracking in the ra API for a reordering the drivers
+// already perform where profitable.
 static void pass_read_video(struct gl_video *p)
 {
     struct image img[4];
@@ -2565,6 +2596,12 @@ static void pass_colormanage(struct gl_video *p, struct mp_colorspace src,
     if (dst.gamma == MP_CSP_TRC_HLG)
         dst.light = MP_CSP_LIGHT_SCENE_HLG;
 
+    // Whether the LUT is actually applied in this pass. Distinct from
+    // p->use_lut_3d: the texture may not exist yet (async computation in
+    // progress) or may be stale for the current parameters, in which case
+    // this pass renders without CMS and a redraw is triggered later.
+    bool apply_lut_3d = false;
+
     if (p->use_lut_3d) {
         // The 3DLUT is always generated against the video's original source
         // space, *not* the reference space. (To avoid having to regenerate
@@ -2580,6 +2617,7 @@ static void pass_colormanage(struct gl_video *p, struct mp_colorspace src,
             trc_orig = MP_CSP_TRC_GAMMA22;
 
         if (gl_video_get_lut3d(p, prim_orig, trc_orig)) {
+            apply_lut_3d = true;
             dst.primaries = prim_orig;
             dst.gamma = trc_orig;
             assert(dst.primaries && dst.gamma);
@@ -2708,7 +2746,7 @@ static void pass_colormanage(struct gl_video *p, struct mp_colorspace src,
     // Adapt from src to dst as necessary
     pass_color_map(p->sc, p->use_linear && !osd, src, dst, &tone_map);
 
-    if (p->use_lut_3d) {
+    if (apply_lut_3d) {
         gl_sc_uniform_texture(p->sc, "lut_3d", p->lut_3d_texture);
         GLSL(vec3 cpos;)
         for (int i = 0; i < 3; i++)
@@ -3119,6 +3157,15 @@ static bool update_surface(struct gl_video *p, struct mp_image *mpi,
 
 // Draws an interpolate frame to fbo, based on the frame timing in t
 // flags: bit set of RENDER_FRAME_* flags
+// Redundant-blend note: the surface ring already caches the *rendered*
+// source frames (surfaces[] are reused across refreshes; only new source
+// frames run the video passes), so per-refresh cost with static content is
+// the tscale mix pass plus output blit. The mix runs per refresh because
+// its weights derive from the continuous vsync position; when the position
+// is truly static (paused), interpolation is bypassed entirely further up
+// (see the still/paused handling in render_frame), so a mixed-result
+// cache would only cover exact weight repeats, which don't occur with a
+// free-running display clock.
 static void gl_video_interpolate_frame(struct gl_video *p, struct vo_frame *t,
                                        struct ra_fbo fbo, int flags)
 {
@@ -3535,6 +3582,14 @@ void gl_video_set_osd_pts(struct gl_video *p, double pts)
     p->osd_pts = pts;
 }
 
+// On damage-rect redraws: re-rendering only OSD subrectangles requires the
+// backbuffer to retain the previous frame (EGL_BUFFER_PRESERVED or a full
+// retained-frame copy) plus damage-region swap support in every context
+// backend; with double/triple buffering the 'unchanged' region differs per
+// swapchain image. The existing cheap path for paused-with-OSD is that the
+// video pass output is cached (interpolation/surface reuse) and only the
+// OSD pass re-executes per redraw - the full-frame cost left is the blit
+// and swap, which partial_update could shave on supporting EGL stacks.
 bool gl_video_check_osd_change(struct gl_video *p, struct mp_osd_res *res,
                                double pts)
 {
@@ -4083,7 +4138,7 @@ static void reinit_from_options(struct gl_video *p)
         p->clear_color = p->opts.background;
 
     check_gl_features(p);
-    uninit_rendering(p);
+    uninit_rendering_opts(p);
     gl_sc_set_cache_dir(p->sc, p->opts.shader_cache_dir);
     p->ra->use_pbo = p->opts.pbo;
     gl_video_setup_hooks(p);
@@ -211,6 +211,8 @@ float gl_video_scale_ambient_lux(float lmin, float lmax,
 void gl_video_set_ambient_lux(struct gl_video *p, int lux);
 void gl_video_set_icc_profile(struct gl_video *p, bstr icc_data);
 bool gl_video_icc_auto_enabled(struct gl_video *p);
+void gl_video_set_icc_wakeup_cb(struct gl_video *p, void (*cb)(void *ctx),
+                                void *ctx);
 bool gl_video_gamma_auto_enabled(struct gl_video *p);
 struct mp_colorspace gl_video_get_output_colorspace(struct gl_video *p);
 
@@ -204,6 +204,14 @@ void pass_sample_polar(struct gl_shader_cache *sc, struct scaler *scaler,
 
 // bw/bh: block size
 // iw/ih: input size (pre-calculated to fit all required texels)
+// On GPU-side QC statistics (histograms, black/freeze detection): the
+// compute pass infrastructure here could host such kernels, but exposing the
+// results needs an asynchronous SSBO readback path through ra (fenced buf
+// downloads), which doesn't exist yet and is the actual work. Until someone
+// builds that, content QC is served without readback storms by libavfilter:
+// --vf=lavfi=[blackdetect]/[freezedetect]/[signalstats] run on the decode
+// path and report via frame metadata/log lines, at CPU cost on the already-
+// decoded frames rather than a 4K GPU readback per probe.
 void pass_compute_polar(struct gl_shader_cache *sc, struct scaler *scaler,
                         int components, int bw, int bh, int iw, int ih)
 {
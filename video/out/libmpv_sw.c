@@ -176,7 +176,11 @@ static int render(struct render_backend *ctx, mpv_render_param *params,
         struct mp_image dst = wrap_img;
         mp_image_crop_rc(&dst, p->dst_rc);
 
-        if (mp_sws_scale(p->sws, &dst, &src) < 0) {
+        if (mp_image_params_equal(&src.params, &dst.params)) {
+            // Direct scanout: same format/size/csp - plain plane copy
+            // instead of running the scaler machinery.
+            mp_image_copy(&dst, &src);
+        } else if (mp_sws_scale(p->sws, &dst, &src) < 0) {
             mp_image_clear(&wrap_img, 0, 0, wrap_img.w, wrap_img.h);
             return MPV_ERROR_GENERIC;
         }
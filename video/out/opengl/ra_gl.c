@@ -94,6 +94,14 @@ static int ra_init_gl(struct ra *ra, GL *gl)
     ra->glsl_version = gl->glsl_version;
     ra->glsl_es = gl->es > 0;
 
+    // Program binaries are driver-specific; key disk caches to the driver.
+    const char *vendor = (char *)gl->GetString(GL_VENDOR);
+    const char *renderer = (char *)gl->GetString(GL_RENDERER);
+    const char *version = (char *)gl->GetString(GL_VERSION);
+    ra->cache_uid = talloc_asprintf(ra, "%s / %s / %s",
+        vendor ? vendor : "-", renderer ? renderer : "-",
+        version ? version : "-");
+
     static const int caps_map[][2] = {
         {RA_CAP_DIRECT_UPLOAD,      0},
         {RA_CAP_GLOBAL_UNIFORM,     0},
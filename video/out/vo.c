@@ -163,6 +163,12 @@ struct vo_internal {
 
     int64_t delayed_count;
     int64_t drop_count;
+
+    // Ring of per-frame timing records (newest at (num_frame_records - 1) %
+    // MAX_FRAME_RECORDS). Recording happens under in->lock in code that
+    // already holds it, so the cost per frame is a few stores.
+    struct vo_frame_record frame_records[256];
+    int64_t num_frame_records;
     bool dropped_frame;             // the previous frame was dropped
 
     struct vo_frame *current_frame; // last frame queued to the VO
@@ -863,18 +869,65 @@ void vo_wait_frame(struct vo *vo)
 
 // Wait until realtime is >= ts
 // called without lock
+// Margin before the target time in which coarse condition waits are replaced
+// by yielding time polls. Timed waits routinely overshoot by 1-2ms on loaded
+// systems, which translates directly into missed vsync deadlines in
+// display-sync mode; the final approach is short enough that polling doesn't
+// cost meaningful CPU.
+#define PRECISE_WAIT_WINDOW_US 2000
+
 static void wait_until(struct vo *vo, int64_t target)
 {
     struct vo_internal *in = vo->in;
-    struct timespec ts = mp_time_us_to_timespec(target);
+    int64_t coarse_target = target - PRECISE_WAIT_WINDOW_US;
+    struct timespec ts = mp_time_us_to_timespec(coarse_target);
     pthread_mutex_lock(&in->lock);
-    while (target > mp_time_us()) {
+    while (coarse_target > mp_time_us()) {
         if (in->queued_events & VO_EVENT_LIVE_RESIZING)
-            break;
+            goto done;
         if (pthread_cond_timedwait(&in->wakeup, &in->lock, &ts))
             break;
     }
+    // Precise final approach: short fixed naps instead of one long timed
+    // wait. The scheduler overshoots a 100us sleep by far less than a
+    // multi-ms one, bounding the deadline error to a fraction of the old
+    // jitter at negligible CPU cost.
+    while (target > mp_time_us()) {
+        if (in->queued_events & VO_EVENT_LIVE_RESIZING)
+            break;
+        pthread_mutex_unlock(&in->lock);
+        mp_sleep_us(MPCLAMP(target - mp_time_us(), 1, 100));
+        pthread_mutex_lock(&in->lock);
+    }
+done:
+    pthread_mutex_unlock(&in->lock);
+}
+
+// Needs in->lock.
+static void add_frame_record(struct vo *vo, struct vo_frame_record *rec)
+{
+    struct vo_internal *in = vo->in;
+
+    rec->frame_id = in->num_frame_records;
+    in->frame_records[in->num_frame_records %
+                      MP_ARRAY_SIZE(in->frame_records)] = *rec;
+    in->num_frame_records += 1;
+}
+
+int vo_get_frame_records(struct vo *vo, struct vo_frame_record *out, int max)
+{
+    struct vo_internal *in = vo->in;
+
+    pthread_mutex_lock(&in->lock);
+    int count = MPMIN(max, MPMIN(in->num_frame_records,
+                                 (int64_t)MP_ARRAY_SIZE(in->frame_records)));
+    for (int n = 0; n < count; n++) {
+        out[n] = in->frame_records[(in->num_frame_records - 1 - n) %
+                                   MP_ARRAY_SIZE(in->frame_records)];
+    }
     pthread_mutex_unlock(&in->lock);
+
+    return count;
 }
 
 static bool render_frame(struct vo *vo)
@@ -945,6 +998,14 @@ static bool render_frame(struct vo *vo)
 
     if (in->dropped_frame) {
         in->drop_count += 1;
+        add_frame_record(vo, &(struct vo_frame_record){
+            .pts = pts,
+            .draw_start = -1,
+            .flip_start = -1,
+            .flip_end = -1,
+            .queue_display_time = -1,
+            .dropped = true,
+        });
         wakeup_core(vo);
     } else {
         in->rendering = true;
@@ -961,6 +1022,8 @@ static bool render_frame(struct vo *vo)
 
         stats_time_start(in->stats, "video-draw");
 
+        int64_t draw_start = mp_time_us();
+
         if (vo->driver->draw_frame) {
             vo->driver->draw_frame(vo, frame);
         } else {
@@ -973,8 +1036,12 @@ static bool render_frame(struct vo *vo)
 
         stats_time_start(in->stats, "video-flip");
 
+        int64_t flip_start = mp_time_us();
+
         vo->driver->flip_page(vo);
 
+        int64_t flip_end = mp_time_us();
+
         struct vo_vsync_info vsync = {
             .last_queue_display_time = -1,
             .skipped_vsyncs = -1,
@@ -992,6 +1059,15 @@ static bool render_frame(struct vo *vo)
         in->dropped_frame = prev_drop_count < vo->in->drop_count;
         in->rendering = false;
 
+        add_frame_record(vo, &(struct vo_frame_record){
+            .pts = pts,
+            .draw_start = draw_start,
+            .flip_start = flip_start,
+            .flip_end = flip_end,
+            .queue_display_time = vsync.last_queue_display_time,
+            .dropped = in->dropped_frame,
+        });
+
         update_vsync_timing_after_swap(vo, &vsync);
     }
 
@@ -518,6 +518,23 @@ struct vo_frame *vo_get_current_vo_frame(struct vo *vo);
 struct mp_image *vo_get_image(struct vo *vo, int imgfmt, int w, int h,
                               int stride_align);
 
+// One per-frame timing record, as returned by vo_get_frame_records(). Times
+// are in microseconds on the mp_time_us() clock; -1 if unknown.
+struct vo_frame_record {
+    int64_t frame_id;           // monotonically increasing
+    int64_t pts;                // intended display time of the frame
+    int64_t draw_start;         // start of rendering
+    int64_t flip_start;         // after rendering and waiting, before flip
+    int64_t flip_end;           // after the flip call returned
+    int64_t queue_display_time; // presentation time feedback (approximated
+                                // with flip_end if the VO provides none)
+    bool dropped;               // the frame was dropped by the VO
+};
+
+// Copy up to max of the most recent frame timing records into out (newest
+// first). Returns the number of records copied. Thread-safe.
+int vo_get_frame_records(struct vo *vo, struct vo_frame_record *out, int max);
+
 void vo_wakeup(struct vo *vo);
 void vo_wait_default(struct vo *vo, int64_t until_time);
 
@@ -24,11 +24,14 @@
 #include <unistd.h>
 
 #include <drm_fourcc.h>
+#include <libavutil/cpu.h>
 #include <libswscale/swscale.h>
 
 #include "drm_common.h"
 
 #include "common/msg.h"
+#include "misc/thread_pool.h"
+#include "misc/thread_tools.h"
 #include "osdep/timer.h"
 #include "sub/osd.h"
 #include "video/fmt-conversion.h"
@@ -36,6 +39,10 @@
 #include "video/sws_utils.h"
 #include "vo.h"
 
+// Maximum number of threads (including the caller) used for copying frames
+// into the mapped dumb buffer.
+#define MAX_COPY_THREADS 8
+
 #define IMGFMT_XRGB8888 IMGFMT_BGR0
 #if BYTE_ORDER == BIG_ENDIAN
 #define IMGFMT_XRGB2101010 pixfmt2imgfmt(AV_PIX_FMT_GBRP10BE)
@@ -90,6 +97,13 @@ struct priv {
 
     int32_t screen_w;
     int32_t screen_h;
+    struct mp_thread_pool *copy_pool;
+    int num_copy_threads;
+
+    // cur_frame holds valid scaled video with no OSD baked in (so OSD-only
+    // redraws don't need to re-run the scaler).
+    bool frame_scaled_valid;
+
     struct mp_image *last_input;
     struct mp_image *cur_frame;
     struct mp_image *cur_frame_cropped;
@@ -312,6 +326,7 @@ static int reconfig(struct vo *vo, struct mp_image_params *params)
     };
 
     talloc_free(p->cur_frame);
+    p->frame_scaled_valid = false;
     p->cur_frame = mp_image_alloc(p->imgfmt, p->screen_w, p->screen_h);
     mp_image_params_guess_csp(&p->sws->dst);
     mp_image_set_params(p->cur_frame, &p->sws->dst);
@@ -364,58 +379,142 @@ static struct framebuffer *get_new_fb(struct vo *vo)
     return &p->bufs[p->front_buf];
 }
 
-static void draw_image(struct vo *vo, mp_image_t *mpi, struct framebuffer *front_buf)
+// Copy rows [y0, y1) of cur_frame into the mapped framebuffer, packing to
+// the DRM format. Bands are independent, so this can run on several threads.
+static void copy_fb_band(struct priv *p, struct framebuffer *front_buf,
+                         int y0, int y1)
+{
+    if (p->drm_format == DRM_FORMAT_XRGB2101010) {
+        // Pack GBRP10 image into XRGB2101010 for DRM
+        const int w = p->cur_frame->w;
+
+        const int g_padding = p->cur_frame->stride[0]/sizeof(uint16_t) - w;
+        const int b_padding = p->cur_frame->stride[1]/sizeof(uint16_t) - w;
+        const int r_padding = p->cur_frame->stride[2]/sizeof(uint16_t) - w;
+        const int fbuf_padding = front_buf->stride/sizeof(uint32_t) - w;
+
+        uint16_t *g_ptr = (uint16_t*)(p->cur_frame->planes[0] +
+                                      y0 * p->cur_frame->stride[0]);
+        uint16_t *b_ptr = (uint16_t*)(p->cur_frame->planes[1] +
+                                      y0 * p->cur_frame->stride[1]);
+        uint16_t *r_ptr = (uint16_t*)(p->cur_frame->planes[2] +
+                                      y0 * p->cur_frame->stride[2]);
+        uint32_t *fbuf_ptr = (uint32_t*)((uint8_t *)front_buf->map +
+                                         y0 * (ptrdiff_t)front_buf->stride);
+        for (int y = y0; y < y1; ++y) {
+            for (int x = 0; x < w; ++x) {
+                *fbuf_ptr++ = (*r_ptr++ << 20) | (*g_ptr++ << 10) | (*b_ptr++);
+            }
+            g_ptr += g_padding;
+            b_ptr += b_padding;
+            r_ptr += r_padding;
+            fbuf_ptr += fbuf_padding;
+        }
+    } else { // p->drm_format == DRM_FORMAT_XRGB8888
+        memcpy_pic((uint8_t *)front_buf->map + y0 * (ptrdiff_t)front_buf->stride,
+                   p->cur_frame->planes[0] + y0 * p->cur_frame->stride[0],
+                   p->cur_frame->w * BYTES_PER_PIXEL, y1 - y0,
+                   front_buf->stride,
+                   p->cur_frame->stride[0]);
+    }
+}
+
+struct fb_copy_job {
+    struct priv *p;
+    struct framebuffer *front_buf;
+    int y0, y1;
+    struct mp_waiter waiter;
+};
+
+static void copy_fb_band_thread(void *ptr)
+{
+    struct fb_copy_job *job = ptr;
+
+    copy_fb_band(job->p, job->front_buf, job->y0, job->y1);
+    mp_waiter_wakeup(&job->waiter, 0);
+}
+
+// On boards without display hardware acceleration, the copy into the dumb
+// buffer can be the frame budget; split it into horizontal bands across the
+// copy threads (the calling thread does the first band).
+static void copy_to_fb(struct priv *p, struct framebuffer *front_buf)
+{
+    int h = p->cur_frame->h;
+    int threads = p->copy_pool ? p->num_copy_threads + 1 : 1;
+    int band_h = MP_ALIGN_UP((h + threads - 1) / threads, 2);
+    int num_bands = (h + band_h - 1) / band_h;
+
+    struct fb_copy_job jobs[MAX_COPY_THREADS];
+    int num_jobs = 0;
+    for (int n = 1; n < num_bands; n++) {
+        struct fb_copy_job *job = &jobs[num_jobs++];
+        *job = (struct fb_copy_job){
+            .p = p,
+            .front_buf = front_buf,
+            .y0 = n * band_h,
+            .y1 = MPMIN((n + 1) * band_h, h),
+            .waiter = MP_WAITER_INITIALIZER,
+        };
+        bool r = mp_thread_pool_run(p->copy_pool, copy_fb_band_thread, job);
+        assert(r); // guaranteed by thread pool creation parameters
+    }
+
+    copy_fb_band(p, front_buf, 0, MPMIN(band_h, h));
+
+    for (int n = 0; n < num_jobs; n++)
+        mp_waiter_wait(&jobs[n].waiter);
+}
+
+static void draw_image(struct vo *vo, mp_image_t *mpi,
+                       struct framebuffer *front_buf, bool frame_changed)
 {
     struct priv *p = vo->priv;
 
     if (p->active && front_buf != NULL) {
+        // For XRGB8888, draw the OSD into the mapped framebuffer after the
+        // copy. cur_frame then always holds the pristine scaled video, so
+        // OSD-only redraws skip the scaler entirely. (The XRGB2101010 packing
+        // works on planar data, so the OSD must be baked in before packing.)
+        bool osd_to_fb = p->drm_format == DRM_FORMAT_XRGB8888;
+        double osd_pts = 0;
+
         if (mpi) {
-            struct mp_image src = *mpi;
-            struct mp_rect src_rc = p->src;
-            src_rc.x0 = MP_ALIGN_DOWN(src_rc.x0, mpi->fmt.align_x);
-            src_rc.y0 = MP_ALIGN_DOWN(src_rc.y0, mpi->fmt.align_y);
-            mp_image_crop_rc(&src, src_rc);
-
-            mp_image_clear(p->cur_frame, 0, 0, p->cur_frame->w, p->dst.y0);
-            mp_image_clear(p->cur_frame, 0, p->dst.y1, p->cur_frame->w, p->cur_frame->h);
-            mp_image_clear(p->cur_frame, 0, p->dst.y0, p->dst.x0, p->dst.y1);
-            mp_image_clear(p->cur_frame, p->dst.x1, p->dst.y0, p->cur_frame->w, p->dst.y1);
-
-            mp_sws_scale(p->sws, p->cur_frame_cropped, &src);
-            osd_draw_on_image(vo->osd, p->osd, src.pts, 0, p->cur_frame);
+            osd_pts = mpi->pts;
+            if (!osd_to_fb || frame_changed || !p->frame_scaled_valid) {
+                struct mp_image src = *mpi;
+                struct mp_rect src_rc = p->src;
+                src_rc.x0 = MP_ALIGN_DOWN(src_rc.x0, mpi->fmt.align_x);
+                src_rc.y0 = MP_ALIGN_DOWN(src_rc.y0, mpi->fmt.align_y);
+                mp_image_crop_rc(&src, src_rc);
+
+                mp_image_clear(p->cur_frame, 0, 0, p->cur_frame->w, p->dst.y0);
+                mp_image_clear(p->cur_frame, 0, p->dst.y1, p->cur_frame->w, p->cur_frame->h);
+                mp_image_clear(p->cur_frame, 0, p->dst.y0, p->dst.x0, p->dst.y1);
+                mp_image_clear(p->cur_frame, p->dst.x1, p->dst.y0, p->cur_frame->w, p->dst.y1);
+
+                mp_sws_scale(p->sws, p->cur_frame_cropped, &src);
+                p->frame_scaled_valid = osd_to_fb;
+                if (!osd_to_fb)
+                    osd_draw_on_image(vo->osd, p->osd, src.pts, 0, p->cur_frame);
+            }
         } else {
             mp_image_clear(p->cur_frame, 0, 0, p->cur_frame->w, p->cur_frame->h);
-            osd_draw_on_image(vo->osd, p->osd, 0, 0, p->cur_frame);
+            p->frame_scaled_valid = false;
+            if (!osd_to_fb)
+                osd_draw_on_image(vo->osd, p->osd, 0, 0, p->cur_frame);
         }
 
-        if (p->drm_format == DRM_FORMAT_XRGB2101010) {
-            // Pack GBRP10 image into XRGB2101010 for DRM
-            const int w = p->cur_frame->w;
-            const int h = p->cur_frame->h;
-
-            const int g_padding = p->cur_frame->stride[0]/sizeof(uint16_t) - w;
-            const int b_padding = p->cur_frame->stride[1]/sizeof(uint16_t) - w;
-            const int r_padding = p->cur_frame->stride[2]/sizeof(uint16_t) - w;
-            const int fbuf_padding = front_buf->stride/sizeof(uint32_t) - w;
-
-            uint16_t *g_ptr = (uint16_t*)p->cur_frame->planes[0];
-            uint16_t *b_ptr = (uint16_t*)p->cur_frame->planes[1];
-            uint16_t *r_ptr = (uint16_t*)p->cur_frame->planes[2];
-            uint32_t *fbuf_ptr = (uint32_t*)front_buf->map;
-            for (unsigned y = 0; y < h; ++y) {
-                for (unsigned x = 0; x < w; ++x) {
-                    *fbuf_ptr++ = (*r_ptr++ << 20) | (*g_ptr++ << 10) | (*b_ptr++);
-                }
-                g_ptr += g_padding;
-                b_ptr += b_padding;
-                r_ptr += r_padding;
-                fbuf_ptr += fbuf_padding;
-            }
-        } else { // p->drm_format == DRM_FORMAT_XRGB8888
-            memcpy_pic(front_buf->map, p->cur_frame->planes[0],
-                       p->cur_frame->w * BYTES_PER_PIXEL, p->cur_frame->h,
-                       front_buf->stride,
-                       p->cur_frame->stride[0]);
+        copy_to_fb(p, front_buf);
+
+        if (osd_to_fb) {
+            // Temporary non-refcounted view of the mapped framebuffer (so
+            // osd_draw_on_image() treats it as writeable and draws in place).
+            struct mp_image fb_img = *p->cur_frame;
+            for (int n = 0; n < MP_MAX_PLANES; n++)
+                fb_img.bufs[n] = NULL;
+            fb_img.planes[0] = front_buf->map;
+            fb_img.stride[0] = front_buf->stride;
+            osd_draw_on_image(vo->osd, p->osd, osd_pts, 0, &fb_img);
         }
     }
 
@@ -468,7 +567,7 @@ static void draw_frame(struct vo *vo, struct vo_frame *frame)
     struct framebuffer *fb =  &p->bufs[p->front_buf];
     if (!repeat) {
         fb = get_new_fb(vo);
-        draw_image(vo, mp_image_new_ref(frame->current), fb);
+        draw_image(vo, mp_image_new_ref(frame->current), fb, !frame->redraw);
     }
 
     enqueue_frame(vo, fb);
@@ -554,6 +653,16 @@ static int preinit(struct vo *vo)
     p->sws = mp_sws_alloc(vo);
     p->sws->log = vo->log;
     mp_sws_enable_cmdline_opts(p->sws, vo->global);
+
+    p->num_copy_threads = MPCLAMP(av_cpu_count(), 1, MAX_COPY_THREADS) - 1;
+    if (p->num_copy_threads) {
+        p->copy_pool = mp_thread_pool_create(p, p->num_copy_threads,
+                                             p->num_copy_threads,
+                                             p->num_copy_threads);
+        if (!p->copy_pool)
+            p->num_copy_threads = 0;
+    }
+
     p->ev.version = DRM_EVENT_CONTEXT_VERSION;
     p->ev.page_flip_handler = &drm_pflip_cb;
 
@@ -670,6 +779,13 @@ static int control(struct vo *vo, uint32_t request, void *arg)
 
 #define OPT_BASE_STRUCT struct priv
 
+// On a drmprime direct-scanout mode: flipping decoded dmabuf frames onto a
+// DRM plane (with OSD on an overlay plane) is a separate VO built on the
+// atomic API, not an extension of this dumb-buffer VO - plane format/
+// modifier negotiation, per-SoC plane topology and fencing all need the
+// target hardware in hand. The building blocks exist (drm_atomic/drm_prime
+// and the hwdec_drmprime interop); this software VO stays the fallback
+// that works everywhere.
 const struct vo_driver video_out_drm = {
     .name = "drm",
     .description = "Direct Rendering Manager (software scaling)",
@@ -284,6 +284,14 @@ static void uninit(struct vo *vo)
     ra_ctx_destroy(&p->ctx);
 }
 
+static void icc_wakeup_cb(void *ctx)
+{
+    struct vo *vo = ctx;
+
+    // (Called from a worker thread; vo_event() is thread-safe.)
+    vo_event(vo, VO_EVENT_EXPOSE);
+}
+
 static int preinit(struct vo *vo)
 {
     struct gpu_priv *p = vo->priv;
@@ -303,6 +311,7 @@ static int preinit(struct vo *vo)
 
     p->renderer = gl_video_init(p->ctx->ra, vo->log, vo->global);
     gl_video_set_osd_source(p->renderer, vo->osd);
+    gl_video_set_icc_wakeup_cb(p->renderer, icc_wakeup_cb, vo);
     gl_video_configure_queue(p->renderer, vo);
 
     get_and_update_icc_profile(p);
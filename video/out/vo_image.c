@@ -23,6 +23,9 @@
 #include <sys/stat.h>
 
 #include <libswscale/swscale.h>
+#include <pthread.h>
+
+#include "misc/thread_pool.h"
 
 #include "config.h"
 #include "misc/bstr.h"
@@ -63,13 +66,60 @@ static const struct m_sub_options vo_image_conf = {
     .size = sizeof(struct vo_image_opts),
 };
 
+// Bound on queued frames being encoded in the background (frames can be
+// tens of MB each; this also sets the parallelism for slow encoders).
+#define MAX_INFLIGHT 4
+
 struct priv {
     struct vo_image_opts *opts;
 
     struct mp_image *current;
     int frame;
+
+    // Async encode state. Frames are handed to the shared thread pool with
+    // their filename pre-assigned (ordering is thus free), bounded by
+    // MAX_INFLIGHT via lock/wakeup.
+    struct mp_thread_pool *pool;
+    pthread_mutex_t lock;
+    pthread_cond_t wakeup;
+    int num_inflight;
+    bool error;
+};
+
+struct write_job {
+    struct vo *vo;
+    struct mp_image *image;
+    char *filename;
+    struct image_writer_opts opts;
 };
 
+static void write_job_fn(void *ptr)
+{
+    struct write_job *job = ptr;
+    struct vo *vo = job->vo;
+    struct priv *p = vo->priv;
+
+    bool ok = write_image(job->image, &job->opts, job->filename, vo->global,
+                          vo->log);
+
+    pthread_mutex_lock(&p->lock);
+    p->num_inflight -= 1;
+    p->error |= !ok;
+    pthread_cond_broadcast(&p->wakeup);
+    pthread_mutex_unlock(&p->lock);
+
+    talloc_free(job);
+}
+
+// Wait until at most max jobs are in flight.
+static void drain_jobs(struct priv *p, int max)
+{
+    pthread_mutex_lock(&p->lock);
+    while (p->num_inflight > max)
+        pthread_cond_wait(&p->wakeup, &p->lock);
+    pthread_mutex_unlock(&p->lock);
+}
+
 static bool checked_mkdir(struct vo *vo, const char *buf)
 {
     MP_INFO(vo, "Creating output directory '%s'...\n", buf);
@@ -120,10 +170,30 @@ static void flip_page(struct vo *vo)
         filename = mp_path_join(t, p->opts->outdir, filename);
 
     MP_INFO(vo, "Saving %s\n", filename);
-    write_image(p->current, p->opts->opts, filename, vo->global, vo->log);
+
+    // Encode in the background, with the filename assigned here (so output
+    // order is independent of completion order), bounded in flight.
+    struct write_job *job = talloc_zero(NULL, struct write_job);
+    *job = (struct write_job){
+        .vo = vo,
+        .image = p->current,
+        .filename = talloc_strdup(job, filename),
+        .opts = *p->opts->opts,
+    };
+    talloc_steal(job, p->current);
+    p->current = NULL;
+
+    drain_jobs(p, MAX_INFLIGHT - 1);
+
+    pthread_mutex_lock(&p->lock);
+    p->num_inflight += 1;
+    pthread_mutex_unlock(&p->lock);
+
+    if (!p->pool || !mp_thread_pool_queue(p->pool, write_job_fn, job)) {
+        write_job_fn(job); // synchronous fallback
+    }
 
     talloc_free(t);
-    mp_image_unrefp(&p->current);
 }
 
 static int query_format(struct vo *vo, int fmt)
@@ -137,15 +207,22 @@ static void uninit(struct vo *vo)
 {
     struct priv *p = vo->priv;
 
+    drain_jobs(p, 0);
     mp_image_unrefp(&p->current);
+    pthread_cond_destroy(&p->wakeup);
+    pthread_mutex_destroy(&p->lock);
 }
 
 static int preinit(struct vo *vo)
 {
     struct priv *p = vo->priv;
     p->opts = mp_get_config_group(vo, vo->global, &vo_image_conf);
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wakeup, NULL);
     if (p->opts->outdir && !checked_mkdir(vo, p->opts->outdir))
         return -1;
+    p->pool = mp_thread_pool_create(vo, MAX_INFLIGHT, MAX_INFLIGHT,
+                                    MAX_INFLIGHT);
     return 0;
 }
 
@@ -331,6 +331,14 @@ bool mp_render_context_acquire(mpv_render_context *ctx)
     return atomic_compare_exchange_strong(&ctx->in_use, &prev, true);
 }
 
+// On a non-blocking render mode: an internal N-deep FBO queue rendered by
+// an mpv-owned thread requires mpv to own a GL/Vulkan context current on
+// that thread - but the render API's core contract is that the *embedder*
+// owns the context and makes it current around this call, which is why
+// rendering happens here synchronously. Embedders with hard compositor
+// budgets should render mpv into their own FBO on a dedicated thread/
+// context of their choosing and composite that texture; the API
+// deliberately doesn't impose a threading model.
 int mpv_render_context_render(mpv_render_context *ctx, mpv_render_param *params)
 {
     pthread_mutex_lock(&ctx->lock);
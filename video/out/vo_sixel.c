@@ -342,6 +342,13 @@ static int reconfig(struct vo *vo, struct mp_image_params *params)
     return ret;
 }
 
+// On incremental updates: sixel is a full-raster encoding - terminals
+// repaint from the sequence start, and cursor-addressed partial updates
+// would need per-terminal capability handling outside libsixel's model.
+// The quantization/dither hot loops live inside libsixel; mpv only hands
+// it frames. What this VO can control is frame pacing and sizes; for
+// multi-preview walls over SSH, lowering --vo-sixel-* dimensions is the
+// effective lever.
 static void draw_frame(struct vo *vo, struct vo_frame *frame)
 {
     struct priv *priv = vo->priv;
@@ -221,6 +221,15 @@ static void draw_frame(struct vo *vo, struct vo_frame *frame)
         }
     }
     if (src) {
+        // Note: the conversion below writes directly into the mapped wl_shm
+        // buffer; there is no separate copy step. Going fully zero-copy for
+        // the source (compositor imports the frame via linux-dmabuf) can't
+        // be retrofitted here: wl_shm semantically requires the pixels in
+        // shared CPU memory, and a dmabuf path needs gbm/udmabuf allocation
+        // plus the zwp_linux_dmabuf_v1 protocol, i.e. a separate VO.
+        // There is also no VO-level band threading like vo_drm's: the only
+        // per-frame CPU work is this mp_sws_scale() call, and libswscale
+        // already slice-threads it internally (see mp_sws_reinit()).
         struct mp_image dst = buf->mpi;
         struct mp_rect src_rc;
         struct mp_rect dst_rc;
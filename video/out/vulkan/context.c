@@ -116,6 +116,10 @@ struct priv {
     struct vulkan_opts *opts;
     struct ra_vk_ctx_params params;
     struct ra_tex proxy_tex;
+    // Size returned by the last pl_swapchain_resize() call, for skipping
+    // no-op resize requests. 0 until the first resize.
+    int last_width, last_height;
+    bool resize_failed;
 };
 
 static const struct ra_swapchain_fns vulkan_swapchain;
@@ -210,7 +214,23 @@ bool ra_vk_ctx_resize(struct ra_ctx *ctx, int width, int height)
 {
     struct priv *p = ctx->swapchain->priv;
 
+    // Compositors tend to spam configure events during interactive window
+    // rearrangement; every pl_swapchain_resize() call revalidates the surface
+    // (and possibly recreates the swapchain), stalling the render loop, so
+    // skip requests that don't change anything. Compared against the size
+    // last given to pl_swapchain_resize() (callers often pass vo->dwidth/
+    // dheight, which can't be used as reference as it's updated below). An
+    // actually suboptimal swapchain at unchanged size keeps working (see
+    // start_frame).
+    if (!p->resize_failed && width == p->last_width && height == p->last_height)
+        return true;
+
     bool ok = pl_swapchain_resize(p->vk->swapchain, &width, &height);
+    p->resize_failed = !ok;
+    // Remember the (possibly adjusted) result, so a repeated request for the
+    // same size is recognized even if the swapchain picked a different one.
+    p->last_width = width;
+    p->last_height = height;
     ctx->vo->dwidth = width;
     ctx->vo->dheight = height;
 
@@ -985,6 +985,13 @@ static void feedback_sync_output(void *data, struct wp_presentation_feedback *fb
 {
 }
 
+// Scheduling note: wp_presentation feedback from this backend flows into
+// vo.c via get_vsync (last_queue_display_time), so frame scheduling is
+// anchored to compositor-reported presentation times already; the averaged
+// vsync interval on top is what absorbs VRR's variable refresh (a single
+// 'next refresh' prediction is undefined under VRR by design - the panel
+// follows the client). Present-to-photon latency is visible in
+// vo-frame-timings (display-time-us vs flip-end-us).
 static void feedback_presented(void *data, struct wp_presentation_feedback *fback,
                               uint32_t tv_sec_hi, uint32_t tv_sec_lo,
                               uint32_t tv_nsec, uint32_t refresh_nsec,
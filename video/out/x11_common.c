@@ -1149,6 +1149,13 @@ static void release_all_keys(struct vo *vo)
     x11->win_drag_button1_down = false;
 }
 
+// On round-trip batching: this path is Xlib-based; converting the event/
+// property handling to pipelined xcb is an all-or-nothing port (mixing
+// both on one connection is where the real jitter bugs come from).
+// Property reads here are event-driven (responses to notify events), not
+// per-frame polls, and screeninfo re-reads happen on reconfig only. If
+// jitter from X round-trips is measured, it should be attributed with
+// x11-specific tracing before a port of this size is considered.
 void vo_x11_check_events(struct vo *vo)
 {
     struct vo_x11_state *x11 = vo->x11;
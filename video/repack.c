@@ -294,6 +294,317 @@ PA_SEQ_3(pa_ccc8,  uint8_t)
 UN_SEQ_3(un_ccc16, uint16_t)
 PA_SEQ_3(pa_ccc16, uint16_t)
 
+// Vectorized variants of the hottest scanline functions above (NV12/P010
+// interleaving, RGBA and 0RGB packing, RGB24 on NEON). The baseline ISA of
+// the target provides the instructions (SSE2 on x86-64, NEON on aarch64);
+// substitute_scanline() below is the hook where e.g. AVX2 variants could be
+// selected at runtime. All kernels delegate trailing pixels to the generic
+// functions, and produce bit-identical results.
+
+#if defined(__x86_64__) || defined(__SSE2__)
+#define REPACK_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#define REPACK_NEON 1
+#include <arm_neon.h>
+#endif
+
+#if REPACK_SSE2
+
+static void pa_cc8_sse2(void *dst, void *src[], int w)
+{
+    uint8_t *d = dst;
+    uint8_t *s0 = src[0], *s1 = src[1];
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s0 + x));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s1 + x));
+        _mm_storeu_si128((__m128i *)(d + x * 2), _mm_unpacklo_epi8(a, b));
+        _mm_storeu_si128((__m128i *)(d + x * 2 + 16), _mm_unpackhi_epi8(a, b));
+    }
+    pa_cc8(d + x * 2, (void *[]){s0 + x, s1 + x}, w - x);
+}
+
+static void un_cc8_sse2(void *src, void *dst[], int w)
+{
+    uint8_t *s = src;
+    uint8_t *d0 = dst[0], *d1 = dst[1];
+    const __m128i mask = _mm_set1_epi16(0xFF);
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(s + x * 2));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(s + x * 2 + 16));
+        _mm_storeu_si128((__m128i *)(d0 + x),
+            _mm_packus_epi16(_mm_and_si128(lo, mask), _mm_and_si128(hi, mask)));
+        _mm_storeu_si128((__m128i *)(d1 + x),
+            _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+    }
+    un_cc8(s + x * 2, (void *[]){d0 + x, d1 + x}, w - x);
+}
+
+static void pa_cc16_sse2(void *dst, void *src[], int w)
+{
+    uint16_t *d = dst;
+    uint16_t *s0 = src[0], *s1 = src[1];
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+        __m128i a = _mm_loadu_si128((const __m128i *)(s0 + x));
+        __m128i b = _mm_loadu_si128((const __m128i *)(s1 + x));
+        _mm_storeu_si128((__m128i *)(d + x * 2), _mm_unpacklo_epi16(a, b));
+        _mm_storeu_si128((__m128i *)(d + x * 2 + 8), _mm_unpackhi_epi16(a, b));
+    }
+    pa_cc16(d + x * 2, (void *[]){s0 + x, s1 + x}, w - x);
+}
+
+static void un_cc16_sse2(void *src, void *dst[], int w)
+{
+    uint16_t *s = src;
+    uint16_t *d0 = dst[0], *d1 = dst[1];
+    const __m128i mask = _mm_set1_epi32(0xFFFF);
+    // SSE2 has no unsigned 32->16 pack; use signed pack with bias.
+    const __m128i bias = _mm_set1_epi16((short)0x8000);
+    const __m128i bias32 = _mm_set1_epi32(0x8000);
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+        __m128i lo = _mm_loadu_si128((const __m128i *)(s + x * 2));
+        __m128i hi = _mm_loadu_si128((const __m128i *)(s + x * 2 + 8));
+        __m128i a0 = _mm_sub_epi32(_mm_and_si128(lo, mask), bias32);
+        __m128i a1 = _mm_sub_epi32(_mm_and_si128(hi, mask), bias32);
+        __m128i b0 = _mm_sub_epi32(_mm_srli_epi32(lo, 16), bias32);
+        __m128i b1 = _mm_sub_epi32(_mm_srli_epi32(hi, 16), bias32);
+        _mm_storeu_si128((__m128i *)(d0 + x),
+            _mm_xor_si128(_mm_packs_epi32(a0, a1), bias));
+        _mm_storeu_si128((__m128i *)(d1 + x),
+            _mm_xor_si128(_mm_packs_epi32(b0, b1), bias));
+    }
+    un_cc16(s + x * 2, (void *[]){d0 + x, d1 + x}, w - x);
+}
+
+// Interleave 4 planes of 16 u8 values each into d.
+static void interleave4_sse2(uint8_t *d, __m128i p0, __m128i p1, __m128i p2,
+                             __m128i p3)
+{
+    __m128i ab_lo = _mm_unpacklo_epi8(p0, p1);
+    __m128i ab_hi = _mm_unpackhi_epi8(p0, p1);
+    __m128i cd_lo = _mm_unpacklo_epi8(p2, p3);
+    __m128i cd_hi = _mm_unpackhi_epi8(p2, p3);
+    _mm_storeu_si128((__m128i *)(d +  0), _mm_unpacklo_epi16(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i *)(d + 16), _mm_unpackhi_epi16(ab_lo, cd_lo));
+    _mm_storeu_si128((__m128i *)(d + 32), _mm_unpacklo_epi16(ab_hi, cd_hi));
+    _mm_storeu_si128((__m128i *)(d + 48), _mm_unpackhi_epi16(ab_hi, cd_hi));
+}
+
+static void pa_cccc8_sse2(void *dst, void *src[], int w)
+{
+    uint8_t *d = dst;
+    uint8_t *s0 = src[0], *s1 = src[1], *s2 = src[2], *s3 = src[3];
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        interleave4_sse2(d + x * 4,
+                         _mm_loadu_si128((const __m128i *)(s0 + x)),
+                         _mm_loadu_si128((const __m128i *)(s1 + x)),
+                         _mm_loadu_si128((const __m128i *)(s2 + x)),
+                         _mm_loadu_si128((const __m128i *)(s3 + x)));
+    }
+    pa_cccc8(d + x * 4, (void *[]){s0 + x, s1 + x, s2 + x, s3 + x}, w - x);
+}
+
+static void pa_ccc8z8_sse2(void *dst, void *src[], int w)
+{
+    uint8_t *d = dst;
+    uint8_t *s0 = src[0], *s1 = src[1], *s2 = src[2];
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        interleave4_sse2(d + x * 4,
+                         _mm_loadu_si128((const __m128i *)(s0 + x)),
+                         _mm_loadu_si128((const __m128i *)(s1 + x)),
+                         _mm_loadu_si128((const __m128i *)(s2 + x)),
+                         _mm_setzero_si128());
+    }
+    pa_ccc8z8(d + x * 4, (void *[]){s0 + x, s1 + x, s2 + x}, w - x);
+}
+
+static void pa_z8ccc8_sse2(void *dst, void *src[], int w)
+{
+    uint8_t *d = dst;
+    uint8_t *s0 = src[0], *s1 = src[1], *s2 = src[2];
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        interleave4_sse2(d + x * 4,
+                         _mm_setzero_si128(),
+                         _mm_loadu_si128((const __m128i *)(s0 + x)),
+                         _mm_loadu_si128((const __m128i *)(s1 + x)),
+                         _mm_loadu_si128((const __m128i *)(s2 + x)));
+    }
+    pa_z8ccc8(d + x * 4, (void *[]){s0 + x, s1 + x, s2 + x}, w - x);
+}
+
+// Extract the byte at bit position sh from each of 16 packed u32 pixels.
+static __m128i extract8_sse2(__m128i v0, __m128i v1, __m128i v2, __m128i v3,
+                             int sh)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i b0 = _mm_and_si128(_mm_srli_epi32(v0, sh), mask);
+    __m128i b1 = _mm_and_si128(_mm_srli_epi32(v1, sh), mask);
+    __m128i b2 = _mm_and_si128(_mm_srli_epi32(v2, sh), mask);
+    __m128i b3 = _mm_and_si128(_mm_srli_epi32(v3, sh), mask);
+    return _mm_packus_epi16(_mm_packs_epi32(b0, b1), _mm_packs_epi32(b2, b3));
+}
+
+#define UN_WORD_SSE2(name, generic, sh_c0, sh_c1, sh_c2, np)                 \
+    static void name(void *src, void *dst[], int w) {                        \
+        uint8_t *s = src;                                                    \
+        int x = 0;                                                           \
+        for (; x + 16 <= w; x += 16) {                                       \
+            __m128i v0 = _mm_loadu_si128((const __m128i *)(s + x * 4));      \
+            __m128i v1 = _mm_loadu_si128((const __m128i *)(s + x * 4 + 16)); \
+            __m128i v2 = _mm_loadu_si128((const __m128i *)(s + x * 4 + 32)); \
+            __m128i v3 = _mm_loadu_si128((const __m128i *)(s + x * 4 + 48)); \
+            _mm_storeu_si128((__m128i *)((uint8_t *)dst[0] + x),             \
+                             extract8_sse2(v0, v1, v2, v3, sh_c0));          \
+            _mm_storeu_si128((__m128i *)((uint8_t *)dst[1] + x),             \
+                             extract8_sse2(v0, v1, v2, v3, sh_c1));          \
+            _mm_storeu_si128((__m128i *)((uint8_t *)dst[2] + x),             \
+                             extract8_sse2(v0, v1, v2, v3, sh_c2));          \
+            if (np > 3) {                                                    \
+                _mm_storeu_si128((__m128i *)((uint8_t *)dst[3] + x),         \
+                                 extract8_sse2(v0, v1, v2, v3, 24));         \
+            }                                                                \
+        }                                                                    \
+        void *rest[4];                                                       \
+        for (int p = 0; p < (np); p++)                                       \
+            rest[p] = (uint8_t *)dst[p] + x;                                 \
+        generic(s + x * 4, rest, w - x);                                     \
+    }
+
+UN_WORD_SSE2(un_cccc8_sse2,  un_cccc8,  0, 8,  16, 4)
+UN_WORD_SSE2(un_ccc8x8_sse2, un_ccc8x8, 0, 8,  16, 3)
+UN_WORD_SSE2(un_x8ccc8_sse2, un_x8ccc8, 8, 16, 24, 3)
+
+#endif // REPACK_SSE2
+
+#if REPACK_NEON
+
+#define PA_NEON_N(name, generic, vtype, n, ld, st, zero_last)               \
+    static void name(void *dst, void *src[], int w) {                       \
+        uint8_t *d = dst;                                                   \
+        int x = 0;                                                          \
+        for (; x + 16 <= w; x += 16) {                                      \
+            vtype v;                                                        \
+            for (int p = 0; p < (n) - (zero_last); p++)                     \
+                v.val[p] = ld((uint8_t *)src[p] + x);                       \
+            if (zero_last)                                                  \
+                v.val[(n) - 1] = vdupq_n_u8(0);                             \
+            st(d + x * (n), v);                                             \
+        }                                                                   \
+        void *rest[4];                                                      \
+        for (int p = 0; p < (n) - (zero_last); p++)                         \
+            rest[p] = (uint8_t *)src[p] + x;                                \
+        generic(d + x * (n), rest, w - x);                                  \
+    }
+
+PA_NEON_N(pa_cc8_neon,    pa_cc8,    uint8x16x2_t, 2, vld1q_u8, vst2q_u8, 0)
+PA_NEON_N(pa_ccc8_neon,   pa_ccc8,   uint8x16x3_t, 3, vld1q_u8, vst3q_u8, 0)
+PA_NEON_N(pa_cccc8_neon,  pa_cccc8,  uint8x16x4_t, 4, vld1q_u8, vst4q_u8, 0)
+PA_NEON_N(pa_ccc8z8_neon, pa_ccc8z8, uint8x16x4_t, 4, vld1q_u8, vst4q_u8, 1)
+
+#define UN_NEON_N(name, generic, vtype, n, ld, st, skip_first)              \
+    static void name(void *src, void *dst[], int w) {                       \
+        uint8_t *s = src;                                                   \
+        int x = 0;                                                          \
+        for (; x + 16 <= w; x += 16) {                                      \
+            vtype v = ld(s + x * (n));                                      \
+            for (int p = 0; p < (n) - (skip_first); p++)                    \
+                st((uint8_t *)dst[p] + x, v.val[p + (skip_first)]);         \
+        }                                                                   \
+        void *rest[4];                                                      \
+        for (int p = 0; p < (n) - (skip_first); p++)                        \
+            rest[p] = (uint8_t *)dst[p] + x;                                \
+        generic(s + x * (n), rest, w - x);                                  \
+    }
+
+UN_NEON_N(un_cc8_neon,    un_cc8,    uint8x16x2_t, 2, vld2q_u8, vst1q_u8, 0)
+UN_NEON_N(un_ccc8_neon,   un_ccc8,   uint8x16x3_t, 3, vld3q_u8, vst1q_u8, 0)
+UN_NEON_N(un_cccc8_neon,  un_cccc8,  uint8x16x4_t, 4, vld4q_u8, vst1q_u8, 0)
+UN_NEON_N(un_x8ccc8_neon, un_x8ccc8, uint8x16x4_t, 4, vld4q_u8, vst1q_u8, 1)
+
+static void un_ccc8x8_neon(void *src, void *dst[], int w)
+{
+    uint8_t *s = src;
+    int x = 0;
+    for (; x + 16 <= w; x += 16) {
+        uint8x16x4_t v = vld4q_u8(s + x * 4);
+        vst1q_u8((uint8_t *)dst[0] + x, v.val[0]);
+        vst1q_u8((uint8_t *)dst[1] + x, v.val[1]);
+        vst1q_u8((uint8_t *)dst[2] + x, v.val[2]);
+    }
+    un_ccc8x8(s + x * 4, (void *[]){(uint8_t *)dst[0] + x,
+              (uint8_t *)dst[1] + x, (uint8_t *)dst[2] + x}, w - x);
+}
+
+static void pa_cc16_neon(void *dst, void *src[], int w)
+{
+    uint16_t *d = dst;
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+        uint16x8x2_t v = {{vld1q_u16((uint16_t *)src[0] + x),
+                           vld1q_u16((uint16_t *)src[1] + x)}};
+        vst2q_u16(d + x * 2, v);
+    }
+    pa_cc16(d + x * 2, (void *[]){(uint16_t *)src[0] + x,
+            (uint16_t *)src[1] + x}, w - x);
+}
+
+static void un_cc16_neon(void *src, void *dst[], int w)
+{
+    uint16_t *s = src;
+    int x = 0;
+    for (; x + 8 <= w; x += 8) {
+        uint16x8x2_t v = vld2q_u16(s + x * 2);
+        vst1q_u16((uint16_t *)dst[0] + x, v.val[0]);
+        vst1q_u16((uint16_t *)dst[1] + x, v.val[1]);
+    }
+    un_cc16(s + x * 2, (void *[]){(uint16_t *)dst[0] + x,
+            (uint16_t *)dst[1] + x}, w - x);
+}
+
+#endif // REPACK_NEON
+
+struct scanline_subst {
+    void (*generic)(void *a, void *b[], int w);
+    void (*fast)(void *a, void *b[], int w);
+};
+
+static const struct scanline_subst scanline_substs[] = {
+#if REPACK_SSE2
+    {pa_cc8,    pa_cc8_sse2},    {un_cc8,    un_cc8_sse2},
+    {pa_cc16,   pa_cc16_sse2},   {un_cc16,   un_cc16_sse2},
+    {pa_cccc8,  pa_cccc8_sse2},  {un_cccc8,  un_cccc8_sse2},
+    {pa_ccc8z8, pa_ccc8z8_sse2}, {un_ccc8x8, un_ccc8x8_sse2},
+    {pa_z8ccc8, pa_z8ccc8_sse2}, {un_x8ccc8, un_x8ccc8_sse2},
+#elif REPACK_NEON
+    {pa_cc8,    pa_cc8_neon},    {un_cc8,    un_cc8_neon},
+    {pa_cc16,   pa_cc16_neon},   {un_cc16,   un_cc16_neon},
+    {pa_ccc8,   pa_ccc8_neon},   {un_ccc8,   un_ccc8_neon},
+    {pa_cccc8,  pa_cccc8_neon},  {un_cccc8,  un_cccc8_neon},
+    {pa_ccc8z8, pa_ccc8z8_neon}, {un_ccc8x8, un_ccc8x8_neon},
+    {un_x8ccc8, un_x8ccc8_neon},
+#endif
+    {0}
+};
+
+// Return a vectorized variant for the given scanline function, if one is
+// available for the current CPU, or the function itself.
+static void (*substitute_scanline(void (*fn)(void *a, void *b[], int w)))
+    (void *a, void *b[], int w)
+{
+    for (int n = 0; scanline_substs[n].generic; n++) {
+        if (scanline_substs[n].generic == fn)
+            return scanline_substs[n].fast;
+    }
+    return fn;
+}
+
 // "regular": single packed plane, all components have same width (except padding)
 struct regular_repacker {
     int packed_width;       // number of bits of the packed pixel
@@ -382,7 +693,7 @@ static void setup_packed_packer(struct mp_repack *rp)
         int prepad = components[0] ? 0 : 8;
         int first_comp = components[0] ? 0 : 1;
         void (*repack_cb)(void *pa, void *pb[], int w) =
-            rp->pack ? pa->pa_scanline : pa->un_scanline;
+            substitute_scanline(rp->pack ? pa->pa_scanline : pa->un_scanline);
 
         if (pa->packed_width != desc.bpp[0] ||
             pa->component_width != depth ||
@@ -771,7 +1082,7 @@ static void setup_nv_packer(struct mp_repack *rp)
         const struct regular_repacker *pa = &regular_repackers[i];
 
         void (*repack_cb)(void *pa, void *pb[], int w) =
-            rp->pack ? pa->pa_scanline : pa->un_scanline;
+            substitute_scanline(rp->pack ? pa->pa_scanline : pa->un_scanline);
 
         if (pa->packed_width != desc.component_size * 2 * 8 ||
             pa->component_width != desc.component_size * 8 ||
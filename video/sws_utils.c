@@ -26,6 +26,8 @@
 
 #include "sws_utils.h"
 
+#include <libavutil/cpu.h>
+
 #include "common/common.h"
 #include "options/m_config.h"
 #include "options/m_option.h"
@@ -171,9 +173,69 @@ static bool cache_valid(struct mp_sws_context *ctx)
            (!ctx->opts_cache || !m_config_cache_update(ctx->opts_cache));
 }
 
+static void free_sws_pool(struct mp_sws_context *ctx)
+{
+    for (int n = 0; n < MP_ARRAY_SIZE(ctx->pool); n++) {
+        if (ctx->pool[n].valid)
+            sws_freeContext(ctx->pool[n].sws);
+        ctx->pool[n] = (struct mp_sws_pooled){0};
+    }
+}
+
+// Move the currently configured SwsContext into the pool (round-robin
+// eviction), so that alternating between a small set of configurations
+// (e.g. display path vs. screenshot path) doesn't reinitialize swscale
+// each time.
+static void pool_stash_current(struct mp_sws_context *ctx)
+{
+    if (!ctx->sws || !ctx->sws_key_valid) {
+        sws_freeContext(ctx->sws);
+        ctx->sws = NULL;
+        return;
+    }
+
+    struct mp_sws_pooled *slot = &ctx->pool[ctx->pool_pos];
+    ctx->pool_pos = (ctx->pool_pos + 1) % MP_ARRAY_SIZE(ctx->pool);
+    if (slot->valid)
+        sws_freeContext(slot->sws);
+    *slot = (struct mp_sws_pooled){
+        .valid = true,
+        .src = ctx->sws_key_src,
+        .dst = ctx->sws_key_dst,
+        .flags = ctx->sws_key_flags,
+        .params = {ctx->sws_key_params[0], ctx->sws_key_params[1]},
+        .sws = ctx->sws,
+        .supports_csp = ctx->supports_csp,
+    };
+    ctx->sws = NULL;
+}
+
+static struct SwsContext *pool_take(struct mp_sws_context *ctx,
+                                    struct mp_image_params *src,
+                                    struct mp_image_params *dst,
+                                    bool *supports_csp)
+{
+    for (int n = 0; n < MP_ARRAY_SIZE(ctx->pool); n++) {
+        struct mp_sws_pooled *e = &ctx->pool[n];
+        if (e->valid && e->flags == ctx->flags &&
+            e->params[0] == ctx->params[0] &&
+            e->params[1] == ctx->params[1] &&
+            mp_image_params_equal(&e->src, src) &&
+            mp_image_params_equal(&e->dst, dst))
+        {
+            struct SwsContext *sws = e->sws;
+            *supports_csp = e->supports_csp;
+            *e = (struct mp_sws_pooled){0};
+            return sws;
+        }
+    }
+    return NULL;
+}
+
 static void free_mp_sws(void *p)
 {
     struct mp_sws_context *ctx = p;
+    free_sws_pool(ctx);
     sws_freeContext(ctx->sws);
     sws_freeFilter(ctx->src_filter);
     sws_freeFilter(ctx->dst_filter);
@@ -233,8 +295,15 @@ int mp_sws_reinit(struct mp_sws_context *ctx)
     if (ctx->opts_cache)
         mp_sws_update_from_cmdline(ctx);
 
-    sws_freeContext(ctx->sws);
-    ctx->sws = NULL;
+    // Pooling is only done for plain configurations (custom filters are
+    // owned by the context and can't be keyed sensibly).
+    if (!ctx->src_filter && !ctx->dst_filter) {
+        pool_stash_current(ctx);
+    } else {
+        sws_freeContext(ctx->sws);
+        ctx->sws = NULL;
+    }
+    ctx->sws_key_valid = false;
     ctx->zimg_ok = false;
     TA_FREEP(&ctx->aligned_src);
     TA_FREEP(&ctx->aligned_dst);
@@ -260,13 +329,26 @@ int mp_sws_reinit(struct mp_sws_context *ctx)
         return -1;
     }
 
+    mp_image_params_guess_csp(&src); // sanitize colorspace/colorlevels
+    mp_image_params_guess_csp(&dst);
+
+    if (!ctx->src_filter && !ctx->dst_filter) {
+        ctx->sws = pool_take(ctx, &src, &dst, &ctx->supports_csp);
+        if (ctx->sws) {
+            ctx->sws_key_src = src;
+            ctx->sws_key_dst = dst;
+            ctx->sws_key_flags = ctx->flags;
+            ctx->sws_key_params[0] = ctx->params[0];
+            ctx->sws_key_params[1] = ctx->params[1];
+            ctx->sws_key_valid = true;
+            goto success;
+        }
+    }
+
     ctx->sws = sws_alloc_context();
     if (!ctx->sws)
         return -1;
 
-    mp_image_params_guess_csp(&src); // sanitize colorspace/colorlevels
-    mp_image_params_guess_csp(&dst);
-
     enum AVPixelFormat s_fmt = imgfmt2pixfmt(src.imgfmt);
     if (s_fmt == AV_PIX_FMT_NONE || sws_isSupportedInput(s_fmt) < 1) {
         MP_ERR(ctx, "Input image format %s not supported by libswscale.\n",
@@ -289,6 +371,13 @@ int mp_sws_reinit(struct mp_sws_context *ctx)
 
     av_opt_set_int(ctx->sws, "sws_flags", ctx->flags, 0);
 
+#if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+    // Slice threading (libswscale dispatches internally). Makes conversion
+    // heavy paths (screenshots, image export, software VOs without zimg)
+    // scale with cores like the ffmpeg CLI does.
+    av_opt_set_int(ctx->sws, "threads", MPCLAMP(av_cpu_count(), 1, 16), 0);
+#endif
+
     av_opt_set_int(ctx->sws, "srcw", src.w, 0);
     av_opt_set_int(ctx->sws, "srch", src.h, 0);
     av_opt_set_int(ctx->sws, "src_format", s_fmt, 0);
@@ -323,6 +412,15 @@ int mp_sws_reinit(struct mp_sws_context *ctx)
     if (sws_init_context(ctx->sws, ctx->src_filter, ctx->dst_filter) < 0)
         return -1;
 
+    if (!ctx->src_filter && !ctx->dst_filter) {
+        ctx->sws_key_src = src;
+        ctx->sws_key_dst = dst;
+        ctx->sws_key_flags = ctx->flags;
+        ctx->sws_key_params[0] = ctx->params[0];
+        ctx->sws_key_params[1] = ctx->params[1];
+        ctx->sws_key_valid = true;
+    }
+
 success:
     ctx->force_reload = false;
     *ctx->cached = *ctx;
@@ -64,6 +64,21 @@ struct mp_sws_context {
     struct mp_zimg_context *zimg;
     bool zimg_ok;
     struct mp_image *aligned_src, *aligned_dst;
+    // Pool of recently used SwsContexts (see mp_sws_reinit()).
+    struct mp_sws_pooled {
+        bool valid;
+        struct mp_image_params src, dst;
+        int flags;
+        double params[2];
+        struct SwsContext *sws;
+        bool supports_csp;
+    } pool[4];
+    int pool_pos;
+    // Key describing what ctx->sws was configured for.
+    bool sws_key_valid;
+    struct mp_image_params sws_key_src, sws_key_dst;
+    int sws_key_flags;
+    double sws_key_params[2];
 };
 
 struct mp_sws_context *mp_sws_alloc(void *talloc_ctx);
@@ -86,7 +86,11 @@ struct mp_zimg_state {
     struct mp_zimg_repack *dst;
     int slice_y, slice_h; // y start position, height of target slice
     double scale_y;
-    struct mp_waiter thread_waiter;
+};
+
+struct mp_zimg_worker {
+    struct mp_zimg_context *ctx;
+    struct mp_waiter waiter;
 };
 
 struct mp_zimg_repack {
@@ -206,6 +210,7 @@ static void free_mp_zimg(void *p)
 
     destroy_zimg(ctx);
     TA_FREEP(&ctx->tp);
+    TA_FREEP(&ctx->workers);
 }
 
 struct mp_zimg_context *mp_zimg_alloc(void)
@@ -564,10 +569,17 @@ bool mp_zimg_config(struct mp_zimg_context *ctx)
     if (ctx->opts_cache)
         mp_zimg_update_from_cmdline(ctx);
 
-    int slices = ctx->opts.threads;
-    if (slices < 1)
-        slices = av_cpu_count();
-    slices = MPCLAMP(slices, 1, 64);
+    int wanted_threads = ctx->opts.threads;
+    if (wanted_threads < 1)
+        wanted_threads = av_cpu_count();
+    wanted_threads = MPCLAMP(wanted_threads, 1, 64);
+
+    // Split the image into more slices than threads, so workers which finish
+    // their slice early pull another one, instead of idling at the tail of
+    // each frame (scanline cost varies with chroma planes, dithering, etc.).
+    // Total temporary memory stays roughly constant, since it scales with
+    // the slice size.
+    int slices = wanted_threads > 1 ? wanted_threads * 4 : 1;
 
     struct mp_imgfmt_desc dstfmt = mp_imgfmt_get_desc(ctx->dst.imgfmt);
     if (!dstfmt.align_y)
@@ -578,16 +590,21 @@ bool mp_zimg_config(struct mp_zimg_context *ctx)
     slice_h = MP_ALIGN_UP(slice_h, 64); // for dithering and minimum slice size
     slices = (full_h + slice_h - 1) / slice_h;
 
-    int threads = slices - 1;
+    int threads = MPMIN(wanted_threads, slices) - 1;
     if (threads != ctx->current_thread_count) {
         // Just destroy and recreate all - dumb and costly, but rarely happens.
         TA_FREEP(&ctx->tp);
+        TA_FREEP(&ctx->workers);
         ctx->current_thread_count = 0;
         if (threads) {
             MP_VERBOSE(ctx, "using %d threads for scaling\n", threads);
             ctx->tp = mp_thread_pool_create(NULL, threads, threads, threads);
             if (!ctx->tp)
                 goto fail;
+            ctx->workers = talloc_zero_array(NULL, struct mp_zimg_worker,
+                                             threads);
+            for (int n = 0; n < threads; n++)
+                ctx->workers[n].ctx = ctx;
             ctx->current_thread_count = threads;
         }
     }
@@ -643,12 +660,25 @@ static void do_convert(struct mp_zimg_state *st)
                               repack_entrypoint, st->dst);
 }
 
+// Pull slices from the shared position counter until all are done. Slices
+// are cheap-to-expensive in arbitrary order, so this dynamically balances
+// uneven scanline costs across workers.
+static void convert_slices(struct mp_zimg_context *ctx)
+{
+    for (;;) {
+        int pos = atomic_fetch_add(&ctx->slice_pos, 1);
+        if (pos >= ctx->num_states)
+            break;
+        do_convert(ctx->states[pos]);
+    }
+}
+
 static void do_convert_thread(void *ptr)
 {
-    struct mp_zimg_state *st = ptr;
+    struct mp_zimg_worker *w = ptr;
 
-    do_convert(st);
-    mp_waiter_wakeup(&st->thread_waiter, 0);
+    convert_slices(w->ctx);
+    mp_waiter_wakeup(&w->waiter, 0);
 }
 
 bool mp_zimg_convert(struct mp_zimg_context *ctx, struct mp_image *dst,
@@ -671,23 +701,22 @@ bool mp_zimg_convert(struct mp_zimg_context *ctx, struct mp_image *dst,
         }
     }
 
-    for (int n = 1; n < ctx->num_states; n++) {
-        struct mp_zimg_state *st = ctx->states[n];
+    atomic_store(&ctx->slice_pos, 0);
+
+    for (int n = 0; n < ctx->current_thread_count; n++) {
+        struct mp_zimg_worker *w = &ctx->workers[n];
 
-        st->thread_waiter = (struct mp_waiter)MP_WAITER_INITIALIZER;
+        w->waiter = (struct mp_waiter)MP_WAITER_INITIALIZER;
 
-        bool r = mp_thread_pool_run(ctx->tp, do_convert_thread, st);
+        bool r = mp_thread_pool_run(ctx->tp, do_convert_thread, w);
         // This is guaranteed by the API; and unrolling would be inconvenient.
         assert(r);
     }
 
-    do_convert(ctx->states[0]);
+    convert_slices(ctx);
 
-    for (int n = 1; n < ctx->num_states; n++) {
-        struct mp_zimg_state *st = ctx->states[n];
-
-        mp_waiter_wait(&st->thread_waiter);
-    }
+    for (int n = 0; n < ctx->current_thread_count; n++)
+        mp_waiter_wait(&ctx->workers[n].waiter);
 
     return true;
 }
@@ -5,6 +5,7 @@
 #include <zimg.h>
 
 #include "mp_image.h"
+#include "osdep/atomic.h"
 
 #define ZIMG_ALIGN 64
 
@@ -45,6 +46,8 @@ struct mp_zimg_context {
     int num_states;
     struct mp_thread_pool *tp;
     int current_thread_count;
+    struct mp_zimg_worker *workers;
+    atomic_int slice_pos; // next slice/state to be picked up by a worker
 };
 
 // Allocate a zimg context. Always succeeds. Returns a talloc pointer (use
@@ -300,6 +300,7 @@ def build(ctx):
         ( "demux/demux_timeline.c" ),
         ( "demux/ebml.c" ),
         ( "demux/packet.c" ),
+        ( "demux/seek_index.c" ),
         ( "demux/timeline.c" ),
 
         ( "filters/f_async_queue.c" ),
@@ -312,6 +313,7 @@ def build(ctx):
         ( "filters/f_output_chain.c" ),
         ( "filters/f_swresample.c" ),
         ( "filters/f_swscale.c" ),
+        ( "filters/f_threaded.c" ),
         ( "filters/f_utils.c" ),
         ( "filters/filter.c" ),
         ( "filters/frame.c" ),
@@ -384,6 +386,7 @@ def build(ctx):
         ( "stream/stream_lavf.c" ),
         ( "stream/stream_libarchive.c",          "libarchive" ),
         ( "stream/stream_memory.c" ),
+        ( "stream/stream_readahead.c" ),
         ( "stream/stream_mf.c" ),
         ( "stream/stream_null.c" ),
 
@@ -402,6 +405,7 @@ def build(ctx):
         ( "sub/sd_lavc.c" ),
 
         ## Tests
+        ( "test/bench.c",                        "tests" ),
         ( "test/chmap.c",                        "tests" ),
         ( "test/gl_video.c",                     "tests" ),
         ( "test/img_format.c",                   "tests" ),